@@ -1,43 +1,96 @@
 #include "animations.h"
+#include "brightness_table.h"
+#include "timeline.h"
+
+// Shared by every pulsing scene
+static constexpr BrightnessTable PULSE_LEVELS(true);
+
+static constexpr const char* EXCLAMATION_ART[Sprite::SIZE] = {
+    "2......2",
+    "2..11..2",
+    "2..11..2",
+    "2..11..2",
+    "2..11..2",
+    "2......2",
+    "2..11..2",
+    "2..11..2"
+};
+
+static constexpr const char* BIN_ART[Sprite::SIZE] = {
+    "..####..",
+    "########",
+    ".#....#.",
+    ".#.##.#.",
+    ".#....#.",
+    ".#.##.#.",
+    ".#....#.",
+    ".######."
+};
+
+static constexpr const char* COMPLETE_ART[Sprite::SIZE] = {
+    "..####..",
+    ".#....#.",
+    "#.#..#.#",
+    "#......#",
+    "#.#..#.#",
+    "#..##..#",
+    ".#....#.",
+    "..####.."
+};
+
+static constexpr const char* PULSE_ART[Sprite::SIZE] = {
+    "........",
+    "........",
+    "........",
+    "...##...",
+    "...##...",
+    "........",
+    "........",
+    "........"
+};
 
-const uint8_t Animations::exclamation[8][8] = {
-    {2,0,0,0,0,0,0,2},
-    {2,0,0,1,1,0,0,2},
-    {2,0,0,1,1,0,0,2},
-    {2,0,0,1,1,0,0,2},
-    {2,0,0,1,1,0,0,2},
-    {2,0,0,0,0,0,0,2},
-    {2,0,0,1,1,0,0,2},
-    {2,0,0,1,1,0,0,2}
+static constexpr const char* OFFLINE_ART[Sprite::SIZE] = {
+    ".......#",
+    "........",
+    "........",
+    "........",
+    "........",
+    "........",
+    "........",
+    "........"
 };
 
-const uint8_t Animations::binImage[8][8] = {
-    {0,0,1,1,1,1,0,0},
-    {1,1,1,1,1,1,1,1},
-    {0,1,0,0,0,0,1,0},
-    {0,1,0,1,1,0,1,0},
-    {0,1,0,0,0,0,1,0},
-    {0,1,0,1,1,0,1,0},
-    {0,1,0,0,0,0,1,0},
-    {0,1,1,1,1,1,1,0}
+// The loading/setup spinner runs clockwise round the 6x6 ring inside the
+// border, two lights opposite each other
+static const uint8_t SPINNER_RING[] = {
+    9, 10, 11, 12, 13, 14,   // top, left to right
+    22, 30, 38, 46, 54,      // right, downwards
+    53, 52, 51, 50, 49,      // bottom, right to left
+    41, 33, 25, 17           // left, upwards
 };
+static const uint8_t SPINNER_STEPS = sizeof(SPINNER_RING);
 
-const uint8_t Animations::completeImage[8][8] = {
-    {0,0,1,1,1,1,0,0},
-    {0,1,0,0,0,0,1,0},
-    {1,0,1,0,0,1,0,1},
-    {1,0,0,0,0,0,0,1},
-    {1,0,1,0,0,1,0,1},
-    {1,0,0,1,1,0,0,1},
-    {0,1,0,0,0,0,1,0},
-    {0,0,1,1,1,1,0,0}
+// One step every 120 ms
+static const Keyframe SPINNER_KEYS[] = {
+    {0, 0},
+    {(SPINNER_STEPS - 1) * 120, SPINNER_STEPS - 1}
 };
+static const Timeline SPINNER = {SPINNER_KEYS, 2, SPINNER_STEPS * 120, Interpolation::LINEAR};
+
+static constexpr Sprite EXCLAMATION_STROKE = Sprite::fromArt(EXCLAMATION_ART, '1');
+static constexpr Sprite EXCLAMATION_DOT = Sprite::fromArt(EXCLAMATION_ART, '2');
+static constexpr Sprite BIN_SPRITE = Sprite::fromArt(BIN_ART);
+static constexpr Sprite COMPLETE_SPRITE = Sprite::fromArt(COMPLETE_ART);
+static constexpr Sprite PULSE_SPRITE = Sprite::fromArt(PULSE_ART);
+static constexpr Sprite OFFLINE_SPRITE = Sprite::fromArt(OFFLINE_ART);
 
-int Animations::brightnessTick = 0;
-int Animations::loadingPos = 0;
-int Animations::animationCounter = 0;
 unsigned long Animations::lastPulseTime = 0;
 
+const uint32_t Animations::PULSE_PERIOD_MS;
+const uint32_t Animations::PULSE_FRAME_MS;
+const uint32_t Animations::LOADING_FRAME_MS;
+const uint8_t Animations::ERROR_BRIGHTNESS;
+
 const Color Animations::ERROR_RED(50, 0, 0);
 const Color Animations::ERROR_DOT_BLUE(0, 0, 50);
 const Color Animations::ERROR_DOT_YELLOW(50, 50, 0);
@@ -48,8 +101,8 @@ const Color Animations::RUBBISH_BROWN(40, 10, 0);
 const Color Animations::DEFAULT_BLUE(0, 0, 50);
 const Color Animations::SETUP_YELLOW(50, 50, 0);
 const Color Animations::LOADING_WHITE(50, 50, 50);
+const Color Animations::OFFLINE_AMBER(50, 20, 0);
 
-Color Animations::prepareColor = LOADING_WHITE;
 
 uint8_t Animations::calculateBrightness() {
     unsigned long currentTime = millis();
@@ -57,13 +110,8 @@ uint8_t Animations::calculateBrightness() {
         lastPulseTime = currentTime;
     }
 
-    // Use a 3-second cycle for the pulse (3000ms)
-    float phase = ((currentTime - lastPulseTime) % 3000) / 3000.0;
-    // Use sine wave for smooth transitions, map to 0-255 range
-    float sinValue = (sin(2.0 * PI * phase) + 1.0) / 2.0;
-    // Apply easing for more natural brightness perception
-    float easedValue = sinValue * sinValue;  // Square for perceived brightness
-    return (uint8_t)(easedValue * 255);
+    // Squared sine over a 3-second cycle, for perceived brightness
+    return PULSE_LEVELS.at(currentTime - lastPulseTime, PULSE_PERIOD_MS);
 }
 
 void Animations::drawError(DisplayHandler& display, ErrorType type) {
@@ -83,139 +131,67 @@ void Animations::drawError(DisplayHandler& display, ErrorType type) {
     drawError(display, ERROR_RED, dot);
 }
 
+// Errors can last for hours, so the frame is held rather than pulsed
 void Animations::drawError(DisplayHandler& display, Color stroke, Color dot) {
-    uint8_t brightness = calculateBrightness();
-
-    for (int row = 0; row < 8; row++) {
-        for (int col = 0; col < 8; col++) {
-            if (exclamation[row][col] == 1) {  // stroke
-                display.setPixelColor(row * 8 + col,
-                    display.matrix.Color(
-                        (stroke.r * brightness) / 64,
-                        (stroke.g * brightness) / 64,
-                        (stroke.b * brightness) / 64
-                    )
-                );
-            } else if (exclamation[row][col] == 2) {  // dot
-                display.setPixelColor(row * 8 + col,
-                    display.matrix.Color(
-                        (dot.r * brightness) / 64,
-                        (dot.g * brightness) / 64,
-                        (dot.b * brightness) / 64
-                    )
-                );
-            }
-        }
-    }
-}
+    uint8_t brightness = ERROR_BRIGHTNESS;
 
-void Animations::updateLoadingPosition() {
-    animationCounter++;
-    if (animationCounter >= ANIMATION_SPEED) {
-        animationCounter = 0;
-        loadingPos = (loadingPos + 1) % 24;
-    }
+    display.blit(EXCLAMATION_STROKE, scaleColor(display, stroke, brightness, 64));
+    display.blit(EXCLAMATION_DOT, scaleColor(display, dot, brightness, 64));
 }
 
-void Animations::drawPrepare(DisplayHandler& display) {
-    int pos1_row, pos1_col, pos2_row, pos2_col;
-
-    if (loadingPos < 6) {
-        pos1_row = 1;
-        pos1_col = loadingPos + 1;
-    } else if (loadingPos < 12) {
-        pos1_row = loadingPos - 4;
-        pos1_col = 6;
-    } else if (loadingPos < 18) {
-        pos1_row = 6;
-        pos1_col = 17 - loadingPos;
-    } else {
-        pos1_row = 23 - loadingPos;
-        pos1_col = 1;
-    }
-
-    int oppositePos = (loadingPos + 12) % 24;
-
-    if (oppositePos < 6) {
-        pos2_row = 1;
-        pos2_col = oppositePos + 1;
-    } else if (oppositePos < 12) {
-        pos2_row = oppositePos - 4;
-        pos2_col = 6;
-    } else if (oppositePos < 18) {
-        pos2_row = 6;
-        pos2_col = 17 - oppositePos;
-    } else {
-        pos2_row = 23 - oppositePos;
-        pos2_col = 1;
-    }
+// The palette entry for this frame, worked out once rather than per pixel
+uint32_t Animations::scaleColor(DisplayHandler& display, Color color, uint8_t brightness, int divisor) {
+    return display.matrix.Color(
+        (color.r * brightness) / divisor,
+        (color.g * brightness) / divisor,
+        (color.b * brightness) / divisor
+    );
+}
 
-    display.setPixelColor(pos1_row * 8 + pos1_col,
-        display.matrix.Color(prepareColor.r, prepareColor.g, prepareColor.b));
-    display.setPixelColor(pos2_row * 8 + pos2_col,
-        display.matrix.Color(prepareColor.r, prepareColor.g, prepareColor.b));
+void Animations::drawPrepare(DisplayHandler& display, Color color) {
+    uint8_t step = SPINNER.sample(millis());
+    uint32_t pixelColor = display.matrix.Color(color.r, color.g, color.b);
 
-    updateLoadingPosition();
+    display.setPixelColor(SPINNER_RING[step], pixelColor);
+    display.setPixelColor(SPINNER_RING[(step + SPINNER_STEPS / 2) % SPINNER_STEPS], pixelColor);
 }
 
 void Animations::drawLoading(DisplayHandler& display) {
-    prepareColor = LOADING_WHITE;
-    drawPrepare(display);
+    drawPrepare(display, LOADING_WHITE);
 }
 
 void Animations::drawSetupMode(DisplayHandler& display) {
-    prepareColor = SETUP_YELLOW;
-    drawPrepare(display);
+    drawPrepare(display, SETUP_YELLOW);
 }
 
 void Animations::drawPulse(DisplayHandler& display, Color color) {
-    uint8_t brightness = calculateBrightness();
-
-    for (int row = 3; row < 5; row++) {
-        for (int col = 3; col < 5; col++) {
-            display.setPixelColor(row * 8 + col,
-                display.matrix.Color(
-                    (color.r * brightness) / 255,
-                    (color.g * brightness) / 255,
-                    (color.b * brightness) / 255
-                )
-            );
-        }
-    }
+    display.blit(PULSE_SPRITE, scaleColor(display, color, calculateBrightness(), 255));
 }
 
 void Animations::drawBinImage(DisplayHandler& display, Color color) {
-    uint8_t brightness = calculateBrightness();
-
-    for (int row = 0; row < 8; row++) {
-        for (int col = 0; col < 8; col++) {
-            if (binImage[row][col] == 1) {
-                display.setPixelColor(row * 8 + col,
-                    display.matrix.Color(
-                        (color.r * brightness) / 64,
-                        (color.g * brightness) / 64,
-                        (color.b * brightness) / 64
-                    )
-                );
-            }
-        }
-    }
+    display.blit(BIN_SPRITE, scaleColor(display, color, calculateBrightness(), 64));
 }
 
 void Animations::drawComplete(DisplayHandler& display, Color color) {
-    uint8_t brightness = calculateBrightness();
-
-    for (int row = 0; row < 8; row++) {
-        for (int col = 0; col < 8; col++) {
-            if (completeImage[row][col] == 1) {
-                display.setPixelColor(row * 8 + col,
-                    display.matrix.Color(
-                        (color.r * brightness) / 64,
-                        (color.g * brightness) / 64,
-                        (color.b * brightness) / 64
-                    )
-                );
-            }
-        }
+    display.blit(COMPLETE_SPRITE, scaleColor(display, color, calculateBrightness(), 64));
+}
+
+// A steady corner dot, meant for the overlay layer
+void Animations::drawOfflineIndicator(DisplayHandler& display) {
+    display.blit(OFFLINE_SPRITE, display.matrix.Color(OFFLINE_AMBER.r, OFFLINE_AMBER.g, OFFLINE_AMBER.b));
+}
+
+uint32_t Animations::frameIntervalMs(Scene scene) {
+    switch (scene) {
+        case Scene::LOADING:
+        case Scene::SETUP_MODE:
+            return LOADING_FRAME_MS;
+        case Scene::ERROR:
+            return 0;
+        case Scene::BIN:
+        case Scene::COMPLETE:
+        case Scene::PULSE:
+        default:
+            return PULSE_FRAME_MS;
     }
 }
@@ -14,6 +14,15 @@ struct Color {
         : r(red), g(green), b(blue) {}
 };
 
+enum class Scene {
+    LOADING,
+    SETUP_MODE,
+    ERROR,
+    BIN,
+    COMPLETE,
+    PULSE
+};
+
 class Animations {
     public:
         static const Color ERROR_RED;
@@ -26,27 +35,29 @@ class Animations {
         static const Color SETUP_YELLOW;
         static const Color LOADING_WHITE;
         static const Color COMPLETE_GREEN;
+        static const Color OFFLINE_AMBER;
 
         static void drawError(DisplayHandler& display, ErrorType type);
-        static void drawPrepare(DisplayHandler& display);
         static void drawLoading(DisplayHandler& display);
         static void drawSetupMode(DisplayHandler& display);
         static void drawPulse(DisplayHandler& display, Color color);
         static void drawBinImage(DisplayHandler& display, Color color);
         static void drawComplete(DisplayHandler& display, Color color);
+        static void drawOfflineIndicator(DisplayHandler& display);
+
+        // How often a scene needs redrawing; 0 for a static scene, which is
+        // drawn once and left until the next command
+        static uint32_t frameIntervalMs(Scene scene);
 
     private:
-        static const uint8_t exclamation[8][8];
-        static const uint8_t binImage[8][8];
-        static const uint8_t completeImage[8][8];
-        static int brightnessTick;
-        static int loadingPos;
-        static int animationCounter;
-        static const int ANIMATION_SPEED = 4;
-        static Color prepareColor;
+        static const uint32_t PULSE_PERIOD_MS = 3000;
+        static const uint32_t PULSE_FRAME_MS = 30;
+        static const uint32_t LOADING_FRAME_MS = 120;
+        static const uint8_t ERROR_BRIGHTNESS = 128;
         static unsigned long lastPulseTime;
 
         static uint8_t calculateBrightness();
-        static void updateLoadingPosition();
+        static void drawPrepare(DisplayHandler& display, Color color);
         static void drawError(DisplayHandler& display, Color stroke, Color dot);
+        static uint32_t scaleColor(DisplayHandler& display, Color color, uint8_t brightness, int divisor);
 };
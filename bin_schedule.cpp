@@ -0,0 +1,174 @@
+#include "bin_schedule.h"
+#include <time.h>
+
+const uint8_t BinSchedule::RECYCLING;
+const uint8_t BinSchedule::RUBBISH;
+const int BinSchedule::WINDOW_DAYS;
+const int BinSchedule::MAX_EVENTS;
+const int BinSchedule::DEFAULT_HORIZON_DAYS;
+const int32_t BinSchedule::RECHECK_S;
+
+Preferences BinSchedule::preferences;
+const char* BinSchedule::PREF_NAMESPACE = "schedule";
+const char* BinSchedule::KEY_WINDOW = "window";
+const char* BinSchedule::KEY_SYNC_TOKEN = "sync_token";
+
+BinSchedule::Window BinSchedule::window = {};
+bool BinSchedule::loaded = false;
+int BinSchedule::horizonDays = BinSchedule::DEFAULT_HORIZON_DAYS;
+
+bool BinSchedule::Window::add(uint32_t idHash, int32_t day, uint8_t mask) {
+    int32_t offset = day - firstDay;
+    if (offset < 0 || offset >= WINDOW_DAYS) return false;
+
+    bins[offset] |= mask;
+    if (full()) return false;
+
+    events[eventCount++] = {idHash, static_cast<uint8_t>(offset), mask};
+    return true;
+}
+
+// Drops an event and rebuilds the bitmask of the day it was on
+bool BinSchedule::Window::remove(uint32_t idHash) {
+    for (int i = 0; i < eventCount; i++) {
+        if (events[i].idHash != idHash) continue;
+
+        uint8_t offset = events[i].offset;
+        events[i] = events[--eventCount];
+
+        bins[offset] = 0;
+        for (int j = 0; j < eventCount; j++) {
+            if (events[j].offset == offset) bins[offset] |= events[j].bins;
+        }
+        return true;
+    }
+    return false;
+}
+
+void BinSchedule::begin() {
+    if (loaded) return;
+    loaded = true;
+
+    preferences.begin(PREF_NAMESPACE, false);
+    if (preferences.getBytes(KEY_WINDOW, &window, sizeof(window)) != sizeof(window)) {
+        window = Window();
+    }
+}
+
+BinSchedule::Window BinSchedule::startWindow(int32_t firstDay, const String& calendarId) {
+    Window fresh = {};
+    fresh.calendarHash = hashId(calendarId);
+    fresh.firstDay = firstDay;
+    fresh.syncedDay = firstDay;
+    return fresh;
+}
+
+const BinSchedule::Window& BinSchedule::current() {
+    begin();
+    return window;
+}
+
+bool BinSchedule::store(const Window& newWindow, const String& syncToken) {
+    begin();
+    window = newWindow;
+    bool saved = preferences.putBytes(KEY_WINDOW, &window, sizeof(window)) == sizeof(window);
+    if (syncToken.isEmpty()) {
+        preferences.remove(KEY_SYNC_TOKEN);
+    } else {
+        saved = preferences.putString(KEY_SYNC_TOKEN, syncToken) && saved;
+    }
+    return saved;
+}
+
+void BinSchedule::invalidate() {
+    begin();
+    window = Window();
+    preferences.remove(KEY_WINDOW);
+    preferences.remove(KEY_SYNC_TOKEN);
+}
+
+String BinSchedule::getSyncToken() {
+    begin();
+    return preferences.getString(KEY_SYNC_TOKEN, "");
+}
+
+// Whether the cached window holds data for this day, however old
+bool BinSchedule::covers(int32_t day, const String& calendarId) {
+    begin();
+    if (window.firstDay == 0 || window.calendarHash != hashId(calendarId)) return false;
+
+    int32_t offset = day - window.firstDay;
+    return offset >= 0 && offset < WINDOW_DAYS;
+}
+
+bool BinSchedule::isFresh(int32_t today, const String& calendarId) {
+    return covers(today, calendarId) && window.syncedDay == today;
+}
+
+bool BinSchedule::isDueForRecheck(time_t now) {
+    begin();
+    return window.syncedAt == 0 || now - window.syncedAt >= RECHECK_S;
+}
+
+bool BinSchedule::lookup(int32_t day, const String& calendarId, uint8_t& bins) {
+    if (!covers(day, calendarId) || day - window.syncedDay >= horizonDays) return false;
+
+    bins = window.bins[day - window.firstDay];
+    return true;
+}
+
+// Days until the bins due differ from today's, or until the cached data
+// runs out; 0 when today itself can't be answered
+int BinSchedule::daysUntilChange(int32_t today, const String& calendarId) {
+    uint8_t todayBins, bins;
+    if (!lookup(today, calendarId, todayBins)) return 0;
+
+    int days = 1;
+    while (lookup(today + days, calendarId, bins) && bins == todayBins) days++;
+    return days;
+}
+
+void BinSchedule::setHorizonDays(int days) {
+    if (days < 1) days = 1;
+    if (days > WINDOW_DAYS) days = WINDOW_DAYS;
+    horizonDays = days;
+}
+
+bool BinSchedule::today(int32_t& day) {
+    struct tm timeinfo;
+    if (!getLocalTime(&timeinfo)) return false;
+    day = dayNumber(timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday);
+    return true;
+}
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar
+int32_t BinSchedule::dayNumber(int year, int month, int day) {
+    year -= month <= 2;
+    const int32_t era = (year >= 0 ? year : year - 399) / 400;
+    const int32_t yearOfEra = year - era * 400;
+    const int32_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+// Accepts both all-day ("2024-03-21") and timed ("2024-03-21T07:00:00Z") starts
+bool BinSchedule::parseDate(const char* iso, int32_t& day) {
+    if (iso == nullptr) return false;
+
+    int year, month, dayOfMonth;
+    if (sscanf(iso, "%4d-%2d-%2d", &year, &month, &dayOfMonth) != 3) return false;
+    if (month < 1 || month > 12 || dayOfMonth < 1 || dayOfMonth > 31) return false;
+
+    day = dayNumber(year, month, dayOfMonth);
+    return true;
+}
+
+// FNV-1a, enough to tell calendars apart without storing their IDs
+uint32_t BinSchedule::hashId(const String& id) {
+    uint32_t hash = 2166136261u;
+    for (const char* c = id.c_str(); *c; c++) {
+        hash ^= static_cast<uint8_t>(*c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,83 @@
+#ifndef BIN_SCHEDULE_H
+#define BIN_SCHEDULE_H
+
+#include <Arduino.h>
+#ifdef ESP32
+    #include <Preferences.h>
+#else
+    #include "Preferences.h"
+#endif
+
+// Persisted day -> bins-due bitmask cache, refreshed once a day so the hourly
+// checks can be answered without touching the network. The bin events behind
+// the bitmasks are indexed by ID hash so incremental (sync token) deltas can
+// move or cancel them.
+class BinSchedule {
+    public:
+        static const uint8_t RECYCLING = 0x01;
+        static const uint8_t RUBBISH = 0x02;
+
+        static const int WINDOW_DAYS = 21;
+        static const int MAX_EVENTS = 32;
+        // How many days after the last sync its data is still trusted
+        static const int DEFAULT_HORIZON_DAYS = 7;
+        // A same-day check this long after the last sync asks Google for the
+        // changes since; under WakePlanner::MAX_SLEEP_S so a capped wake does
+        static const int32_t RECHECK_S = 5 * 60 * 60;
+
+        struct Event {
+            uint32_t idHash;
+            uint8_t offset;
+            uint8_t bins;
+        };
+
+        struct Window {
+            uint32_t calendarHash;
+            int32_t firstDay;
+            int32_t syncedDay;
+            int64_t syncedAt;      // Wall clock of the last sync, 0 if unknown
+            uint8_t bins[WINDOW_DAYS];
+            uint8_t eventCount;
+            Event events[MAX_EVENTS];
+
+            // False outside the window, or when the event table is full; a
+            // day past the full table still gets its bins, but no later
+            // delta can move or cancel the event
+            bool add(uint32_t idHash, int32_t day, uint8_t mask);
+            bool remove(uint32_t idHash);
+            bool full() const { return eventCount >= MAX_EVENTS; }
+        };
+
+        static void begin();
+        static Window startWindow(int32_t firstDay, const String& calendarId);
+        static const Window& current();
+        static bool store(const Window& window, const String& syncToken);
+        static void invalidate();
+
+        static String getSyncToken();
+        static bool covers(int32_t day, const String& calendarId);
+        static bool isFresh(int32_t today, const String& calendarId);
+        static bool isDueForRecheck(time_t now);
+        static bool lookup(int32_t day, const String& calendarId, uint8_t& bins);
+        static int daysUntilChange(int32_t today, const String& calendarId);
+
+        static void setHorizonDays(int days);
+        static int getHorizonDays() { return horizonDays; }
+
+        static bool today(int32_t& day);
+        static int32_t dayNumber(int year, int month, int day);
+        static bool parseDate(const char* iso, int32_t& day);
+        static uint32_t hashId(const String& id);
+
+    private:
+        static Preferences preferences;
+        static const char* PREF_NAMESPACE;
+        static const char* KEY_WINDOW;
+        static const char* KEY_SYNC_TOKEN;
+
+        static Window window;
+        static bool loaded;
+        static int horizonDays;
+};
+
+#endif
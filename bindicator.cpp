@@ -1,7 +1,8 @@
 #include "bindicator.h"
 #include <time.h>
 #include "tasks.h"
-#include "config_manager.h"
+#include "state_store.h"
+#include "utils.h"
 #include <Arduino.h>
 
 BindicatorState Bindicator::state = BindicatorState::LOADING;
@@ -137,14 +138,11 @@ void Bindicator::sendStateCommand(BindicatorState state) {
 }
 
 void Bindicator::sendCommand(Command cmd) {
-    if (xQueueSend(commandQueue, &cmd, 0) != pdTRUE) {
-        Serial.println("Failed to send command to queue!");
-    }
+    postCommand(cmd);
 }
 
 void Bindicator::persistState() {
-    ConfigManager::setState(static_cast<int>(state));
-    ConfigManager::setCompletedTime(completedTime);
+    StateStore::save(state, completedTime, millis());
 }
 
 bool Bindicator::isAfterResetTime() {
@@ -156,6 +154,11 @@ bool Bindicator::isAfterResetTime() {
         return false;
     }
 
+    return time(nullptr) >= nextResetTime();
+}
+
+// The first RESET_HOUR after the bin was taken out
+time_t Bindicator::nextResetTime() {
     struct tm nextReset;
     struct tm completedTimeInfo;
     localtime_r(&completedTime, &nextReset);
@@ -168,15 +171,15 @@ bool Bindicator::isAfterResetTime() {
         nextReset.tm_mday++;
     }
 
-    time_t nextResetTime = mktime(&nextReset);
-    time_t now = time(nullptr);
+    return mktime(&nextReset);
+}
 
-    return now >= nextResetTime;
+uint32_t Bindicator::msUntilErrorRetry() {
+    return Utils::msRemaining(lastErrorTime, ERROR_RETRY_INTERVAL_MS, millis());
 }
 
 void Bindicator::initializeFromStorage() {
-    state = static_cast<BindicatorState>(ConfigManager::getState());
-    completedTime = ConfigManager::getCompletedTime();
+    StateStore::load(state, completedTime);
 
     if (state == BindicatorState::COMPLETED && isAfterResetTime()) {
         transitionTo(BindicatorState::LOADING);
@@ -189,6 +192,24 @@ void Bindicator::initializeFromStorage() {
     }
 }
 
+// Picks up where the device left off before a deep sleep; StateStore already
+// holds the same state, so nothing is written back. The sleep already waited
+// out any error retry interval, and millis() restarted with it, so an error
+// retries straight away.
+void Bindicator::restoreState(BindicatorState savedState, time_t savedCompletedTime) {
+    state = savedState;
+    completedTime = savedCompletedTime;
+
+    if (state == BindicatorState::COMPLETED && isAfterResetTime()) {
+        transitionTo(BindicatorState::LOADING);
+    } else if (isInErrorState()) {
+        lastErrorTime = 0;
+        transitionTo(BindicatorState::LOADING);
+    } else {
+        sendStateCommand(state);
+    }
+}
+
 void Bindicator::enterSetupMode() {
     transitionTo(BindicatorState::SETUP);
 }
@@ -17,6 +17,7 @@ class Bindicator {
         static bool shouldCheckCalendar();
         static void updateFromCalendar(CollectionState collectionState);
         static void initializeFromStorage();
+        static void restoreState(BindicatorState savedState, time_t savedCompletedTime);
         static void setErrorState(ErrorType errorType);
         static bool isInErrorState();
         static bool isBinTakenOut();
@@ -24,6 +25,10 @@ class Bindicator {
         static void exitSetupMode();
         static bool isInSetupMode();
         static void clearErrorState();
+        static BindicatorState getState() { return state; }
+        static time_t getCompletedTime() { return completedTime; }
+        static time_t nextResetTime();
+        static uint32_t msUntilErrorRetry();
 
     private:
         static BindicatorState state;
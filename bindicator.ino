@@ -17,6 +17,10 @@
 #include "button_handler.h"
 #include "bindicator.h"
 #include "bin_type.h"
+#include "bin_schedule.h"
+#include "http_pool.h"
+#include "power_manager.h"
+#include "state_store.h"
 
 OAuthHandler oauth(GOOGLE_CLIENT_ID, GOOGLE_CLIENT_SECRET, GOOGLE_REDIRECT_URI);
 CalendarHandler calendar(oauth);
@@ -112,14 +116,14 @@ void startSetupMode() {
     Serial.println("OAuth handler initialized");
 
     Command cmd = CMD_SHOW_SETUP_MODE;
-    xQueueSend(commandQueue, &cmd, 0);
+    postCommand(cmd);
 }
 
 void startNormalMode() {
     if (!tryWiFiConnection()) {
         Serial.println("Failed to connect to WiFi");
         Command cmd = CMD_SHOW_ERROR_WIFI;
-        xQueueSend(commandQueue, &cmd, 0);
+        postCommand(cmd);
         return;
     }
 
@@ -132,18 +136,27 @@ void startNormalMode() {
         NULL,
         0
     );
+
+    oauth.startBackgroundRefresh();
 }
 
 void setup() {
     Serial.begin(115200);
     Serial.println("Starting up...");
     SerialCommands::begin();
-    delay(2000);
+    PowerManager::begin(BUTTON_PIN);
+    if (!PowerManager::wokeFromSleep()) {
+        delay(2000);
+    }
 
     ConfigManager::begin();
+    ConfigManager::startFlusher();
+    BinSchedule::begin();
+    StateStore::begin();
+    HttpPool::begin();
     display.begin();
     oauth.begin(nullptr);
-    commandQueue = xQueueCreate(10, sizeof(Command));
+    commandQueue = xQueueCreate(1, sizeof(Command));
 
     xTaskCreatePinnedToCore(
         animationTask,
@@ -170,9 +183,17 @@ void setup() {
         startNormalMode();
     }
 
-    button.begin();
+    bool buttonHeld = button.begin();
 
-    Bindicator::initializeFromStorage();
+    if (!PowerManager::restoreState()) {
+        Bindicator::initializeFromStorage();
+    }
+
+    // A press short enough to be over before setup() got here still counts;
+    // one still held is timed by the button task
+    if (PowerManager::wokeByButton() && !buttonHeld) {
+        Bindicator::handleButtonPress();
+    }
 }
 
 void loop() {
@@ -0,0 +1,51 @@
+#ifndef BRIGHTNESS_TABLE_H
+#define BRIGHTNESS_TABLE_H
+
+#include <stdint.h>
+
+// One period of a raised sine (0..255) sampled at 256 phases, built at
+// compile time so animations can fade colours with integer maths only. The
+// eased variant is squared, which looks more even on the LEDs.
+class BrightnessTable {
+    public:
+        static const int SIZE = 256;
+
+        constexpr explicit BrightnessTable(bool eased) : levels() {
+            for (int i = 0; i < SIZE; i++) {
+                double level = (sine(2.0 * PI_RADIANS * i / SIZE) + 1.0) / 2.0;
+                if (eased) level *= level;
+                levels[i] = static_cast<uint8_t>(level * 255);
+            }
+        }
+
+        // Level at a point in a repeating cycle of periodMs
+        constexpr uint8_t at(uint32_t elapsedMs, uint32_t periodMs) const {
+            return levels[(uint64_t)(elapsedMs % periodMs) * SIZE / periodMs];
+        }
+
+        constexpr uint8_t operator[](int index) const { return levels[index]; }
+
+        // Scales a 0..255 channel by a level from the table
+        static constexpr uint8_t scale(uint8_t channel, uint8_t level) {
+            return (channel * level) / 255;
+        }
+
+    private:
+        static constexpr double PI_RADIANS = 3.14159265358979323846;
+
+        uint8_t levels[SIZE];
+
+        // Taylor series, accurate to ~1e-6 once reduced to [-pi, pi]
+        static constexpr double sine(double x) {
+            if (x > PI_RADIANS) x -= 2.0 * PI_RADIANS;
+            double term = x;
+            double sum = x;
+            for (int n = 1; n < 10; n++) {
+                term *= -x * x / ((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+};
+
+#endif
@@ -6,9 +6,10 @@
 ButtonHandler::ButtonHandler(uint8_t pin, unsigned long longPressTime)
     : buttonPin(pin), longPressTime(longPressTime) {}
 
-void ButtonHandler::begin() {
+const uint32_t ButtonHandler::DEBOUNCE_MS;
+
+bool ButtonHandler::begin() {
     pinMode(buttonPin, INPUT_PULLUP);
-    state.mutex = xSemaphoreCreateMutex();
 
     xTaskCreate(
         buttonTask,          // Task function
@@ -16,44 +17,70 @@ void ButtonHandler::begin() {
         2048,               // Stack size (bytes)
         this,               // Pass the instance pointer as parameter
         1,                  // Priority
-        NULL                // Task handle
+        &taskHandle         // Task handle, for the interrupt to notify
     );
+
+    attachInterruptArg(digitalPinToInterrupt(buttonPin), onEdge, this, CHANGE);
+
+    // A press that began before the interrupt was attached has no edge left
+    // to report except its release
+    if (digitalRead(buttonPin) != LOW) return false;
+    xTaskNotifyGive(taskHandle);
+    return true;
+}
+
+void IRAM_ATTR ButtonHandler::onEdge(void *arg) {
+    ButtonHandler* handler = static_cast<ButtonHandler*>(arg);
+    if (handler->taskHandle == nullptr) return;
+
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(handler->taskHandle, &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+
+// Waits up to timeout for an edge, then for the contacts to stop bouncing.
+// False if no edge arrived in time.
+bool ButtonHandler::waitForSettledLevel(TickType_t timeout, int& level) {
+    if (ulTaskNotifyTake(pdTRUE, timeout) == 0) return false;
+
+    // Every further edge restarts the debounce window
+    while (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(DEBOUNCE_MS)) > 0) {}
+
+    level = digitalRead(buttonPin);
+    return true;
 }
 
 void ButtonHandler::buttonTask(void *parameter) {
     ButtonHandler* handler = static_cast<ButtonHandler*>(parameter);
-    TickType_t lastWakeTime = xTaskGetTickCount();
-    const TickType_t interval = pdMS_TO_TICKS(20);
+    int level;
 
     while (true) {
-        if (xSemaphoreTake(handler->state.mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-            handler->state.currentState = digitalRead(handler->buttonPin);
-
-            // Button press detected
-            if (handler->state.currentState == LOW && handler->state.lastState == HIGH) {
-                handler->state.pressedTime = millis();
-                handler->state.isLongPressHandled = false;
-            }
-            // Button is being held
-            else if (handler->state.currentState == LOW && !handler->state.isLongPressHandled) {
-                if (millis() - handler->state.pressedTime >= handler->longPressTime) {
-                    handler->onLongPress();
-                    handler->state.isLongPressHandled = true;
-                }
-            }
-            // Button release detected
-            else if (handler->state.currentState == HIGH && handler->state.lastState == LOW) {
-                if (!handler->state.isLongPressHandled &&
-                    (millis() - handler->state.pressedTime < handler->longPressTime)) {
-                    handler->onShortPress();
-                }
-            }
-
-            handler->state.lastState = handler->state.currentState;
-            xSemaphoreGive(handler->state.mutex);
+        // Idle: blocks until the button is touched
+        if (!handler->waitForSettledLevel(portMAX_DELAY, level) || level != LOW) {
+            continue;
+        }
+
+        // Held: a release before the long press time is a short press
+        unsigned long pressedTime = millis();
+        bool released = false;
+        while (!released) {
+            unsigned long heldMs = millis() - pressedTime;
+            if (heldMs >= handler->longPressTime) break;
+
+            TickType_t remaining = pdMS_TO_TICKS(handler->longPressTime - heldMs);
+            if (!handler->waitForSettledLevel(remaining, level)) break;
+            released = level == HIGH;
+        }
+
+        if (released) {
+            handler->onShortPress();
+            continue;
         }
 
-        vTaskDelayUntil(&lastWakeTime, interval);
+        handler->onLongPress();
+
+        // Don't treat the eventual release as a new press
+        while (!handler->waitForSettledLevel(portMAX_DELAY, level) || level != HIGH) {}
     }
 }
 
@@ -67,10 +94,11 @@ void BindicatorButton::onShortPress() {
 void BindicatorButton::onLongPress() {
     Serial.println("Long press detected - entering setup mode");
     ConfigManager::setForcedSetupFlag("restart-in-setup-mode");
+    ConfigManager::flush();
 
     extern DisplayHandler display;
     display.matrix.clear();
-    display.matrix.show();
+    display.show();
     delay(50);
 
     ESP.restart();
@@ -2,29 +2,30 @@
 
 #include <Arduino.h>
 
+// The button task sleeps until the pin's edge interrupt notifies it, then
+// times the debounce and long press with notification timeouts, so an
+// untouched button costs no wakeups at all.
 class ButtonHandler {
 public:
     ButtonHandler(uint8_t pin, unsigned long longPressTime = 3000);
-    void begin();
+    // True if the button was already held, in which case the task times
+    // that press as if it had seen the edge
+    bool begin();
 
     virtual void onShortPress() {};
     virtual void onLongPress() {};
 
 private:
+    static const uint32_t DEBOUNCE_MS = 30;
+
+    static void IRAM_ATTR onEdge(void *arg);
     static void buttonTask(void *parameter);
 
+    bool waitForSettledLevel(TickType_t timeout, int& level);
+
     const uint8_t buttonPin;
     const unsigned long longPressTime;
-
-    struct ButtonState {
-        bool lastState = HIGH;
-        bool currentState = HIGH;
-        unsigned long pressedTime = 0;
-        bool isLongPressHandled = false;
-        SemaphoreHandle_t mutex;
-    };
-
-    ButtonState state;
+    TaskHandle_t taskHandle = nullptr;
 };
 
 // Main button
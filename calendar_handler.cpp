@@ -3,6 +3,12 @@
 #include "config_manager.h"
 #include "utils.h"
 #include "bin_type.h"
+#include "bin_schedule.h"
+#include "http_pool.h"
+
+const char* CalendarHandler::EVENT_FIELDS =
+    "items(id,status,summary,start(date,dateTime)),nextPageToken,nextSyncToken";
+const char* CalendarHandler::CALENDAR_LIST_FIELDS = "items(id,summary)";
 
 CalendarHandler::CalendarHandler(OAuthHandler& oauthHandler)
     : oauth(oauthHandler) {}
@@ -14,72 +20,201 @@ bool CalendarHandler::isBinEvent(const String& summary, bool& isRecycling, bool&
 }
 
 bool CalendarHandler::checkForBinEvents(bool& hasRecycling, bool& hasRubbish) {
-    String today = getISODate();
-    if (today.isEmpty()) {
+    int32_t today;
+    if (!BinSchedule::today(today)) {
         Serial.println("Failed to get current date");
         Command cmd = CMD_SHOW_ERROR_OTHER;
-        xQueueSend(commandQueue, &cmd, 0);
+        postCommand(cmd);
         return false;
     }
 
-    String timeMin = today + "T00:00:00Z";
-    String timeMax = today + "T23:59:59Z";
+    String calendarId = ConfigManager::getCalendarId();
 
-    Serial.println("Checking calendar for date: " + today);
+    // Synced today, but edits made since are only seen by asking again
+    if (BinSchedule::isFresh(today, calendarId) && !BinSchedule::isDueForRecheck(time(nullptr))) {
+        Serial.println("Using cached bin schedule");
+    } else if (!refreshSchedule(today, calendarId)) {
+        Serial.println("Failed to refresh bin schedule, trying cached copy");
+    }
 
-    if (!oauth.getValidToken(access_token)) {
-        Serial.println("Failed to get valid token");
+    uint8_t bins;
+    if (!BinSchedule::lookup(today, calendarId, bins)) {
+        Serial.println("No usable bin schedule for today");
         Command cmd = CMD_SHOW_ERROR_API;
-        xQueueSend(commandQueue, &cmd, 0);
+        postCommand(cmd);
         return false;
     }
 
-    HTTPClient http;
-    String url = CALENDAR_API_BASE + ConfigManager::getCalendarId() + "/events";
-    url += "?timeMin=" + Utils::urlEncode(timeMin);
-    url += "&timeMax=" + Utils::urlEncode(timeMax);
-    url += "&singleEvents=true";
-
-    Serial.println("Calendar request URL: " + url);
+    hasRecycling = bins & BinSchedule::RECYCLING;
+    hasRubbish = bins & BinSchedule::RUBBISH;
+    return true;
+}
 
-    http.begin(url);
-    http.addHeader("Authorization", "Bearer " + access_token);
+bool CalendarHandler::hasFreshSchedule() {
+    int32_t today;
+    return BinSchedule::today(today) && BinSchedule::isFresh(today, ConfigManager::getCalendarId());
+}
 
-    int httpResponseCode = http.GET();
-    if (httpResponseCode != 200) {
-        Serial.println("Calendar API Error: " + String(httpResponseCode));
-        Command cmd = CMD_SHOW_ERROR_API;
-        xQueueSend(commandQueue, &cmd, 0);
-        http.end();
+// Brings the cached schedule up to date. With a stored sync token only the
+// changes since the last sync are downloaded; a full windowed sync happens the
+// first time, after a calendar change, once the window has run out, or when
+// Google expires the token (410 Gone).
+bool CalendarHandler::refreshSchedule(int32_t today, const String& calendarId) {
+    String token;
+    if (!oauth.getValidToken(token)) {
+        Serial.println("Failed to get valid token");
         return false;
     }
 
-    String payload = http.getString();
+    String syncToken = BinSchedule::getSyncToken();
+    String nextSyncToken;
+
+    if (!syncToken.isEmpty() && BinSchedule::covers(today, calendarId)) {
+        Serial.println("Requesting calendar changes since last sync");
+
+        BinSchedule::Window window = BinSchedule::current();
+        bool indexed = true;
+        int result = fetchEvents(token, calendarId, "syncToken=" + Utils::urlEncode(syncToken),
+                                 [&](JsonDocument& event) { indexed = applyEvent(window, event) && indexed; },
+                                 nextSyncToken);
+        if (result == 200 && indexed) {
+            window.syncedDay = today;
+            window.syncedAt = time(nullptr);
+            return BinSchedule::store(window, nextSyncToken);
+        }
+        if (result != 200 && result != 410) return false;
 
-    Serial.println("Calendar API Response:");
-    Serial.println(payload);
+        Serial.println(result == 410 ? "Sync token expired, doing a full resync"
+                                     : "Bin event table full, doing a full resync");
+    }
 
-    StaticJsonDocument<2048> doc;
-    DeserializationError error = deserializeJson(doc, payload);
-    if (error) {
-        Serial.print("deserializeJson() failed: ");
-        Serial.println(error.c_str());
-        http.end();
+    String timeMin = getISODate();
+    String timeMax = getISODate(BinSchedule::WINDOW_DAYS - 1);
+    if (timeMin.isEmpty() || timeMax.isEmpty()) {
+        Serial.println("Failed to get valid time range for bin schedule");
         return false;
     }
 
-    hasRecycling = false;
-    hasRubbish = false;
+    Serial.println("Full bin schedule sync from: " + timeMin);
+
+    String query = "timeMin=" + Utils::urlEncode(timeMin + "T00:00:00Z");
+    query += "&timeMax=" + Utils::urlEncode(timeMax + "T23:59:59Z");
+
+    BinSchedule::Window window = BinSchedule::startWindow(today, calendarId);
+    bool indexed = true;
+    int result = fetchEvents(token, calendarId, query,
+                             [&](JsonDocument& event) { indexed = applyEvent(window, event) && indexed; },
+                             nextSyncToken);
+    if (result != 200) return false;
+    window.syncedAt = time(nullptr);
+
+    // The days are all there, but deltas can't be applied to events the
+    // table couldn't hold, so the next refresh syncs in full again
+    if (!indexed) {
+        Serial.println("Bin event table full, not keeping the sync token");
+        nextSyncToken = "";
+    }
+
+    return BinSchedule::store(window, nextSyncToken);
+}
+
+// Builds an events list URL asking only for the fields readEvents keeps,
+// so neither the TLS transfer nor the parser sees descriptions, attendees etc.
+String CalendarHandler::eventsUrl(const String& calendarId, const String& query, const String& pageToken) {
+    String url = CALENDAR_API_BASE + Utils::urlEncode(calendarId) + "/events";
+    url += "?" + query;
+    url += "&singleEvents=true";
+    url += "&maxResults=" + String(EVENTS_PER_PAGE);
+    url += "&fields=" + String(EVENT_FIELDS);
+    if (!pageToken.isEmpty()) {
+        url += "&pageToken=" + Utils::urlEncode(pageToken);
+    }
+    return url;
+}
+
+// Pages through an events query, handing every event to the callback.
+// ifNoneMatch and onResponse apply to the first page only. Returns the HTTP
+// status of the first failing page (304 included), or 200.
+int CalendarHandler::fetchEvents(const String& token, const String& calendarId, const String& query,
+                                 JsonListReader::ItemHandler onEvent, String& nextSyncToken,
+                                 const String& ifNoneMatch, ResponseHandler onResponse,
+                                 int* pageCount) {
+    String pageToken;
+    int pages = 0;
+
+    do {
+        String url = eventsUrl(calendarId, query, pageToken);
+
+        Serial.println("Calendar request URL: " + url);
+
+        HttpPool::Lease connection(url);
+        HTTPClient& http = connection.http();
+        http.addHeader("Authorization", "Bearer " + token);
+        if (pages == 0 && !ifNoneMatch.isEmpty()) http.addHeader("If-None-Match", ifNoneMatch);
+
+        int httpResponseCode = connection.GET();
+        if (httpResponseCode == 304 && pages == 0 && !ifNoneMatch.isEmpty()) return 304;
+        if (httpResponseCode != 200) {
+            Serial.println("Calendar API Error: " + String(httpResponseCode));
+            return httpResponseCode;
+        }
+        if (pages++ == 0 && onResponse) onResponse(http.header("ETag"));
+        if (pageCount != nullptr) *pageCount = pages;
+
+        String pageSyncToken;
+        if (!readEvents(connection.body(), onEvent, &pageToken, &pageSyncToken)) return -1;
+        nextSyncToken = pageSyncToken;
+    } while (!pageToken.isEmpty());
+
+    return 200;
+}
+
+// Full syncs only list live events; deltas also carry cancellations.
+// False if the event table was full, so the window can no longer take deltas.
+bool CalendarHandler::applyEvent(BinSchedule::Window& window, JsonDocument& event) {
+    uint32_t idHash = BinSchedule::hashId(event["id"].as<String>());
+    window.remove(idHash);
+
+    if (event["status"].as<String>() == "cancelled") return true;
+
+    String summary = event["summary"].as<String>();
+    bool isRecycling, isRubbish;
+    if (!isBinEvent(summary, isRecycling, isRubbish)) return true;
+
+    const char* start = event["start"]["date"];
+    if (start == nullptr) start = event["start"]["dateTime"];
 
-    JsonArray items = doc["items"];
-    for (JsonVariant item : items) {
-        String summary = item["summary"].as<String>();
+    int32_t day;
+    if (!BinSchedule::parseDate(start, day)) return true;
+
+    uint8_t bins = (isRecycling ? BinSchedule::RECYCLING : 0) |
+                   (isRubbish ? BinSchedule::RUBBISH : 0);
+    if (window.add(idHash, day, bins)) {
         Serial.println("Found event: " + summary);
-        if (summary.indexOf("(recycling)") >= 0) hasRecycling = true;
-        if (summary.indexOf("(rubbish)") >= 0) hasRubbish = true;
+        return true;
     }
+    if (!window.full()) return true;
+
+    Serial.println("Bin event table full, not indexed: " + summary);
+    return false;
+}
 
-    http.end();
+// Parses an events list response item by item, keeping only the fields we use
+bool CalendarHandler::readEvents(Stream& stream, JsonListReader::ItemHandler onEvent,
+                                 String* nextPageToken, String* nextSyncToken) {
+    StaticJsonDocument<128> filter;
+    filter["id"] = true;
+    filter["status"] = true;
+    filter["summary"] = true;
+    filter["start"]["date"] = true;
+    filter["start"]["dateTime"] = true;
+
+    StaticJsonDocument<EVENT_DOC_SIZE> event;
+    JsonListReader reader(stream);
+    if (!reader.read(event, filter, onEvent)) return false;
+
+    if (nextPageToken != nullptr) *nextPageToken = reader.getNextPageToken();
+    if (nextSyncToken != nullptr) *nextSyncToken = reader.getNextSyncToken();
     return true;
 }
 
@@ -98,95 +233,79 @@ String CalendarHandler::getISODate(int daysOffset) {
     return String(timeStringBuff);
 }
 
-bool CalendarHandler::getAvailableCalendars(JsonDocument& calendars) {
-    if (!oauth.getValidToken(access_token)) {
+// Hands the account's calendars to onCalendar one at a time, straight off
+// the response stream. ifNoneMatch is passed on to Google, so a browser
+// revalidating its copy gets Google's 304 back; onResponse receives the
+// list's ETag before the first calendar. Returns the HTTP status, or -1.
+int CalendarHandler::streamCalendars(const String& ifNoneMatch, ResponseHandler onResponse,
+                                     JsonListReader::ItemHandler onCalendar) {
+    String token;
+    if (!oauth.getValidToken(token)) {
         Serial.println("Failed to get valid token for calendar list request");
-        return false;
+        return -1;
     }
 
-    HTTPClient http;
     String url = "https://www.googleapis.com/calendar/v3/users/me/calendarList";
+    url += "?fields=" + String(CALENDAR_LIST_FIELDS);
 
-    http.begin(url);
-    http.addHeader("Authorization", "Bearer " + access_token);
+    HttpPool::Lease connection(url);
+    HTTPClient& http = connection.http();
+    http.addHeader("Authorization", "Bearer " + token);
+    if (!ifNoneMatch.isEmpty()) http.addHeader("If-None-Match", ifNoneMatch);
 
-    int httpResponseCode = http.GET();
+    int httpResponseCode = connection.GET();
+    if (httpResponseCode == 304) return 304;
     if (httpResponseCode != 200) {
         Serial.println("Calendar List API Error: " + String(httpResponseCode));
-        http.end();
-        return false;
+        return httpResponseCode;
     }
 
-    String payload = http.getString();
-    DeserializationError error = deserializeJson(calendars, payload);
-
-    http.end();
+    onResponse(http.header("ETag"));
 
-    if (error) {
-        Serial.print("deserializeJson() failed: ");
-        Serial.println(error.c_str());
-        return false;
-    }
+    StaticJsonDocument<64> filter;
+    filter["id"] = true;
+    filter["summary"] = true;
 
-    return true;
+    StaticJsonDocument<CALENDAR_DOC_SIZE> calendar;
+    JsonListReader reader(connection.body());
+    return reader.read(calendar, filter, onCalendar) ? 200 : -1;
 }
 
-bool CalendarHandler::getUpcomingBinDays(JsonDocument& events) {
-    if (!oauth.getValidToken(access_token)) {
+// Hands the bin events of the next few weeks to onEvent one at a time, with
+// the first page's ETag going to onResponse beforehand. Google's ETag only
+// covers that page, so singlePage says whether it covers the whole listing
+// and can be revalidated later. Returns the HTTP status, or -1.
+int CalendarHandler::streamUpcomingBinDays(const String& ifNoneMatch, ResponseHandler onResponse,
+                                           JsonListReader::ItemHandler onEvent, bool& singlePage) {
+    String token;
+    if (!oauth.getValidToken(token)) {
         Serial.println("Failed to get valid token for upcoming events request");
-        return false;
+        return -1;
     }
 
-    HTTPClient http;
     String calendarId = ConfigManager::getCalendarId();
-    String url = CALENDAR_API_BASE + Utils::urlEncode(calendarId) + "/events";
-
     String timeMin = getISODate();
     String timeMax = getISODate(DAYS_TO_CHECK_BIN_SCHEDULE);
 
     if (timeMin.isEmpty() || timeMax.isEmpty()) {
         Serial.println("Failed to get valid time range for upcoming bins");
-        return false;
-    }
-
-    url += "?timeMin=" + timeMin + "T00:00:00Z";
-    url += "&timeMax=" + timeMax + "T23:59:59Z";
-    url += "&singleEvents=true";
-    url += "&orderBy=startTime";
-
-    http.begin(url);
-    http.addHeader("Authorization", "Bearer " + access_token);
-
-    int httpResponseCode = http.GET();
-    if (httpResponseCode != 200) {
-        Serial.println("Calendar Events API Error: " + String(httpResponseCode));
-        String response = http.getString();
-        http.end();
-        return false;
+        return -1;
     }
 
-    String payload = http.getString();
-    StaticJsonDocument<4096> allEvents;
+    String query = "timeMin=" + timeMin + "T00:00:00Z";
+    query += "&timeMax=" + timeMax + "T23:59:59Z";
+    query += "&orderBy=startTime";
 
-    DeserializationError error = deserializeJson(allEvents, payload);
-
-    http.end();
-
-    if (error) {
-        Serial.print("deserializeJson() failed: ");
-        Serial.println(error.c_str());
-        return false;
-    }
-
-    JsonArray filteredItems = events.createNestedArray("items");
-
-    for (JsonVariant event : allEvents["items"].as<JsonArray>()) {
+    String nextSyncToken;
+    int pages = 0;
+    int result = fetchEvents(token, calendarId, query, [&](JsonDocument& event) {
         String summary = event["summary"].as<String>();
         bool isRecycling, isRubbish;
         if (isBinEvent(summary, isRecycling, isRubbish)) {
-            filteredItems.add(event);
+            onEvent(event);
         }
-    }
+    }, nextSyncToken, ifNoneMatch, onResponse, &pages);
 
-    return true;
+    singlePage = pages == 1;
+    return result;
 }
@@ -7,23 +7,46 @@
 #include "oauth_handler.h"
 #include "tasks.h"
 #include "bin_type.h"
+#include "json_list_reader.h"
+#include "bin_schedule.h"
 
 class CalendarHandler {
     public:
+        typedef std::function<void(const String& etag)> ResponseHandler;
+
         CalendarHandler(OAuthHandler& oauthHandler);
         bool checkForBinEvents(bool& hasRecycling, bool& hasRubbish);
-        bool getAvailableCalendars(JsonDocument& calendars);
-        bool getUpcomingBinDays(JsonDocument& events);
+        bool hasFreshSchedule();
+        int streamCalendars(const String& ifNoneMatch, ResponseHandler onResponse,
+                            JsonListReader::ItemHandler onCalendar);
+        int streamUpcomingBinDays(const String& ifNoneMatch, ResponseHandler onResponse,
+                                  JsonListReader::ItemHandler onEvent, bool& singlePage);
 
     private:
         OAuthHandler& oauth;
-        String access_token;
         const String CALENDAR_API_BASE = "https://www.googleapis.com/calendar/v3/calendars/";
         static const int DAYS_TO_CHECK_BIN_SCHEDULE = 21;
+        // One filtered event (id, status, summary, start date) at a time
+        static const size_t EVENT_DOC_SIZE = 384;
+        // One filtered calendar (id, summary) at a time
+        static const size_t CALENDAR_DOC_SIZE = 256;
+        static const int EVENTS_PER_PAGE = 50;
+        // Partial responses: only what readEvents and the setup page read
+        static const char* EVENT_FIELDS;
+        static const char* CALENDAR_LIST_FIELDS;
 
         String getISODate(int daysOffset = 0);
         String urlEncode(const String& str);
         bool isBinEvent(const String& summary, bool& isRecycling, bool& isRubbish) const;
+        bool readEvents(Stream& stream, JsonListReader::ItemHandler onEvent,
+                        String* nextPageToken = nullptr, String* nextSyncToken = nullptr);
+        bool refreshSchedule(int32_t today, const String& calendarId);
+        String eventsUrl(const String& calendarId, const String& query, const String& pageToken);
+        int fetchEvents(const String& token, const String& calendarId, const String& query,
+                        JsonListReader::ItemHandler onEvent, String& nextSyncToken,
+                        const String& ifNoneMatch = "", ResponseHandler onResponse = nullptr,
+                        int* pageCount = nullptr);
+        bool applyEvent(BinSchedule::Window& window, JsonDocument& event);
 };
 
 #endif
@@ -1,43 +1,268 @@
 #include "config_manager.h"
+#include <stddef.h>
+#include "utils.h"
 
 Preferences ConfigManager::preferences;
 const char* ConfigManager::PREF_NAMESPACE = "system";
+const char* ConfigManager::KEY_CONFIG = "config";
 const char* ConfigManager::KEY_WIFI_SSID = "wifi_ssid";
 const char* ConfigManager::KEY_WIFI_PASS = "wifi_pass";
 const char* ConfigManager::KEY_FORCE_SETUP = "force_setup";
 const char* ConfigManager::KEY_CALENDAR_ID = "calendar_id";
 const char* ConfigManager::KEY_BIN_TAKEN_OUT = "bin_taken";
 const char* ConfigManager::KEY_BIN_TYPE = "bin_type";
+const char* ConfigManager::KEY_LOW_POWER = "low_power";
 const char* ConfigManager::KEY_STATE = "state";
 const char* ConfigManager::KEY_COMPLETED_TIME = "completed_time";
 
+const uint32_t ConfigManager::FLUSH_DELAY_MS;
+const uint16_t ConfigManager::CONFIG_VERSION;
+
+ConfigManager::Snapshot ConfigManager::snapshot = {};
+std::atomic<uint32_t> ConfigManager::sequence(0);
+SemaphoreHandle_t ConfigManager::writeLock = nullptr;
+SemaphoreHandle_t ConfigManager::flushLock = nullptr;
+TaskHandle_t ConfigManager::flusherTask = nullptr;
+bool ConfigManager::dirty = false;
+uint32_t ConfigManager::flushCount = 0;
+bool ConfigManager::loaded = false;
+bool ConfigManager::hasLegacyState = false;
+int ConfigManager::legacyState = 0;
+time_t ConfigManager::legacyCompletedTime = 0;
+bool ConfigManager::legacyKeysPending = false;
+
 void ConfigManager::begin() {
+    if (loaded) return;
+    loaded = true;
+
+    writeLock = xSemaphoreCreateMutex();
+    flushLock = xSemaphoreCreateMutex();
     preferences.begin(PREF_NAMESPACE, false);
+    load();
 }
 
-bool ConfigManager::isConfigured() {
+ConfigManager::Snapshot ConfigManager::defaults() {
+    Snapshot settings;
+    memset(&settings, 0, sizeof(settings));
+    settings.binType = static_cast<int32_t>(BinType::NONE);
+    strcpy(settings.calendarId, "primary");
+    return settings;
+}
+
+void ConfigManager::load() {
+    Snapshot settings = defaults();
+    bool persist = false;
+
+    if (!preferences.isKey(KEY_CONFIG)) {
+        migrateFromKeys(settings);
+        persist = true;
+    } else if (!loadBlob(settings)) {
+        Serial.println("Saved config is corrupt, starting unconfigured");
+        settings = defaults();
+    }
+
+    write([&settings](Snapshot& s) { s = settings; }, persist);
+}
+
+// Accepts blobs from this version or older ones, whose shorter Snapshot
+// leaves the fields added since at their defaults
+bool ConfigManager::loadBlob(Snapshot& settings) {
+    StoredConfig stored;
+    memset(&stored, 0, sizeof(stored));
+    size_t size = preferences.getBytes(KEY_CONFIG, &stored, sizeof(stored));
+
+    const size_t header = offsetof(StoredConfig, settings);
+    if (size < header + sizeof(uint32_t) || stored.version == 0 || stored.version > CONFIG_VERSION ||
+        size != header + stored.length + sizeof(uint32_t) || stored.length > sizeof(Snapshot)) {
+        return false;
+    }
+
+    uint32_t crc;
+    memcpy(&crc, reinterpret_cast<const uint8_t*>(&stored) + header + stored.length, sizeof(crc));
+    if (crc != checksum(stored, stored.length)) return false;
+
+    memcpy(&settings, &stored.settings, stored.length);
+    settings.wifiSsid[sizeof(settings.wifiSsid) - 1] = '\0';
+    settings.wifiPassword[sizeof(settings.wifiPassword) - 1] = '\0';
+    settings.calendarId[sizeof(settings.calendarId) - 1] = '\0';
+    settings.forceSetup[sizeof(settings.forceSetup) - 1] = '\0';
+    return true;
+}
+
+// Reads the per-setting keys written before the blob existed, then drops
+// them once the blob holding the same values has been saved
+void ConfigManager::migrateFromKeys(Snapshot& settings) {
+    copyString(settings.wifiSsid, sizeof(settings.wifiSsid), preferences.getString(KEY_WIFI_SSID, ""), KEY_WIFI_SSID);
+    copyString(settings.wifiPassword, sizeof(settings.wifiPassword), preferences.getString(KEY_WIFI_PASS, ""), KEY_WIFI_PASS);
+    copyString(settings.calendarId, sizeof(settings.calendarId), preferences.getString(KEY_CALENDAR_ID, "primary"), KEY_CALENDAR_ID);
+    copyString(settings.forceSetup, sizeof(settings.forceSetup), preferences.getString(KEY_FORCE_SETUP, ""), KEY_FORCE_SETUP);
+    settings.binTakenOut = preferences.getInt(KEY_BIN_TAKEN_OUT, 0);
+    settings.binType = preferences.getInt(KEY_BIN_TYPE, static_cast<int>(BinType::NONE));
+    settings.lowPower = preferences.getInt(KEY_LOW_POWER, 0) != 0;
+
+    // The Bindicator state moved to StateStore, which picks it up from here
+    hasLegacyState = preferences.isKey(KEY_STATE);
+    legacyState = preferences.getInt(KEY_STATE, static_cast<int>(BindicatorState::LOADING));
+    legacyCompletedTime = preferences.getInt(KEY_COMPLETED_TIME, 0);
+    legacyKeysPending = true;
+}
+
+uint32_t ConfigManager::checksum(const StoredConfig& stored, size_t length) {
+    return Utils::crc32(&stored, offsetof(StoredConfig, settings) + length);
+}
+
+// Sequence lock: the count is odd while a write is in progress, and a read
+// that overlapped a write sees it change and tries again. A read that finds
+// a write in progress blocks on the writer's mutex instead of spinning, so
+// priority inheritance lets a lower-priority writer finish from any task.
+template <typename T, typename Field>
+T ConfigManager::read(Field field) {
     begin();
-    String ssid = preferences.getString(KEY_WIFI_SSID, "");
-    String password = preferences.getString(KEY_WIFI_PASS, "");
-    return !ssid.isEmpty() && !password.isEmpty();
+    while (true) {
+        uint32_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            xSemaphoreTake(writeLock, portMAX_DELAY);
+            xSemaphoreGive(writeLock);
+            continue;
+        }
+
+        T value = field(snapshot);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before) return value;
+    }
 }
 
-String ConfigManager::getWifiSSID() {
+template <typename Change>
+void ConfigManager::write(Change change, bool persist) {
     begin();
-    return preferences.getString(KEY_WIFI_SSID, "");
+    xSemaphoreTake(writeLock, portMAX_DELAY);
+    sequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    change(snapshot);
+    sequence.fetch_add(1, std::memory_order_release);
+    dirty = dirty || persist;
+    xSemaphoreGive(writeLock);
+
+    if (persist && flusherTask != nullptr) {
+        xTaskNotifyGive(flusherTask);
+    }
 }
 
-String ConfigManager::getWifiPassword() {
+// Truncation would silently corrupt credentials, so over-long values are refused
+bool ConfigManager::copyString(char* dest, size_t size, const String& value, const char* name) {
+    if (value.length() >= size) {
+        Serial.printf("Config value for %s is too long\n", name);
+        dest[0] = '\0';
+        return false;
+    }
+    strcpy(dest, value.c_str());
+    return true;
+}
+
+void ConfigManager::startFlusher() {
     begin();
-    return preferences.getString(KEY_WIFI_PASS, "");
+    if (flusherTask != nullptr) return;
+
+    xTaskCreate(flusherLoop, "ConfigFlush", 4096, nullptr, 1, &flusherTask);
+
+    // Settings just migrated from the old keys are already waiting
+    if (dirty && flusherTask != nullptr) {
+        xTaskNotifyGive(flusherTask);
+    }
 }
 
-bool ConfigManager::setWifiCredentials(const String& ssid, const String& password) {
+void ConfigManager::flusherLoop(void* parameter) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        vTaskDelay(pdMS_TO_TICKS(FLUSH_DELAY_MS));
+        flush();
+    }
+}
+
+// Writes the whole blob if anything changed; a failed write stays dirty
+void ConfigManager::flush() {
     begin();
-    bool success = preferences.putString(KEY_WIFI_SSID, ssid) &&
-                  preferences.putString(KEY_WIFI_PASS, password);
+    xSemaphoreTake(flushLock, portMAX_DELAY);
+
+    xSemaphoreTake(writeLock, portMAX_DELAY);
+    bool changed = dirty;
+    dirty = false;
+    StoredConfig stored;
+    memset(&stored, 0, sizeof(stored));
+    stored.settings = snapshot;
+    xSemaphoreGive(writeLock);
+
+    if (!changed) {
+        xSemaphoreGive(flushLock);
+        return;
+    }
+
+    stored.version = CONFIG_VERSION;
+    stored.length = sizeof(Snapshot);
+    stored.crc = checksum(stored, sizeof(Snapshot));
+
+    const size_t size = offsetof(StoredConfig, crc) + sizeof(stored.crc);
+    if (preferences.putBytes(KEY_CONFIG, &stored, size) == size) {
+        if (legacyKeysPending) {
+            const char* legacyKeys[] = {
+                KEY_WIFI_SSID, KEY_WIFI_PASS, KEY_CALENDAR_ID, KEY_FORCE_SETUP,
+                KEY_BIN_TAKEN_OUT, KEY_BIN_TYPE, KEY_LOW_POWER, KEY_STATE, KEY_COMPLETED_TIME
+            };
+            for (const char* key : legacyKeys) {
+                if (preferences.isKey(key)) preferences.remove(key);
+            }
+            legacyKeysPending = false;
+        }
+    } else {
+        Serial.println("Failed to save settings, will retry");
+        xSemaphoreTake(writeLock, portMAX_DELAY);
+        dirty = true;
+        xSemaphoreGive(writeLock);
+    }
+    flushCount++;
+
+    xSemaphoreGive(flushLock);
+}
+
+// Wipes the namespace and drops any pending writes, for factory resets
+void ConfigManager::reset() {
+    begin();
+    xSemaphoreTake(flushLock, portMAX_DELAY);
+    xSemaphoreTake(writeLock, portMAX_DELAY);
+    dirty = false;
+    xSemaphoreGive(writeLock);
+
+    preferences.clear();
+    hasLegacyState = false;
+    legacyKeysPending = false;
+    write([](Snapshot& s) { s = defaults(); }, false);
+    xSemaphoreGive(flushLock);
+}
+
+bool ConfigManager::isConfigured() {
+    return read<bool>([](const Snapshot& s) {
+        return s.wifiSsid[0] != '\0' && s.wifiPassword[0] != '\0';
+    });
+}
+
+String ConfigManager::getWifiSSID() {
+    return read<String>([](const Snapshot& s) { return String(s.wifiSsid); });
+}
+
+String ConfigManager::getWifiPassword() {
+    return read<String>([](const Snapshot& s) { return String(s.wifiPassword); });
+}
+
+bool ConfigManager::setWifiCredentials(const String& ssid, const String& password) {
+    Snapshot fresh = {};
+    bool success = copyString(fresh.wifiSsid, sizeof(fresh.wifiSsid), ssid, KEY_WIFI_SSID) &&
+                   copyString(fresh.wifiPassword, sizeof(fresh.wifiPassword), password, KEY_WIFI_PASS);
 
     if (success) {
+        write([&fresh](Snapshot& s) {
+            memcpy(s.wifiSsid, fresh.wifiSsid, sizeof(s.wifiSsid));
+            memcpy(s.wifiPassword, fresh.wifiPassword, sizeof(s.wifiPassword));
+        });
         Serial.println("WiFi credentials saved successfully");
     } else {
         Serial.println("Failed to save WiFi credentials");
@@ -46,84 +271,73 @@ bool ConfigManager::setWifiCredentials(const String& ssid, const String& passwor
 }
 
 bool ConfigManager::isInForcedSetupMode() {
-    begin();
-    return preferences.getString(KEY_FORCE_SETUP, "") == "restart-in-setup-mode";
+    return read<bool>([](const Snapshot& s) {
+        return strcmp(s.forceSetup, "restart-in-setup-mode") == 0;
+    });
 }
 
 void ConfigManager::setForcedSetupFlag(const String& flag) {
-    begin();
-    preferences.putString(KEY_FORCE_SETUP, flag);
+    char value[sizeof(Snapshot::forceSetup)];
+    if (!copyString(value, sizeof(value), flag, KEY_FORCE_SETUP)) return;
+
+    write([&value](Snapshot& s) { strcpy(s.forceSetup, value); });
 }
 
 void ConfigManager::processSetupFlag() {
-    begin();
-    String flag = preferences.getString(KEY_FORCE_SETUP, "");
-    if (!flag.isEmpty()) {
-        preferences.putString(KEY_FORCE_SETUP, "");
-        preferences.remove(KEY_FORCE_SETUP);
+    bool isSet = read<bool>([](const Snapshot& s) { return s.forceSetup[0] != '\0'; });
+    if (isSet) {
+        write([](Snapshot& s) { s.forceSetup[0] = '\0'; });
     }
 }
 
 String ConfigManager::getCalendarId() {
-    begin();
-    return preferences.getString(KEY_CALENDAR_ID, "primary");
+    return read<String>([](const Snapshot& s) { return String(s.calendarId); });
 }
 
 bool ConfigManager::setCalendarId(const String& id) {
-    begin();
-    return preferences.putString(KEY_CALENDAR_ID, id);
+    char value[sizeof(Snapshot::calendarId)];
+    if (!copyString(value, sizeof(value), id, KEY_CALENDAR_ID)) return false;
+
+    write([&value](Snapshot& s) { strcpy(s.calendarId, value); });
+    return true;
 }
 
 time_t ConfigManager::getBinTakenOutTime() {
-    begin();
-    return preferences.getInt(KEY_BIN_TAKEN_OUT, 0);
+    return read<int64_t>([](const Snapshot& s) { return s.binTakenOut; });
 }
 
 bool ConfigManager::setBinTakenOutTime(time_t time) {
-    begin();
-    return preferences.putInt(KEY_BIN_TAKEN_OUT, time);
+    write([time](Snapshot& s) { s.binTakenOut = time; });
+    return true;
 }
 
 BinType ConfigManager::getBinType() {
-    begin();
-    return static_cast<BinType>(preferences.getInt(KEY_BIN_TYPE, static_cast<int>(BinType::NONE)));
+    return static_cast<BinType>(read<int32_t>([](const Snapshot& s) { return s.binType; }));
 }
 
 bool ConfigManager::setBinType(BinType type) {
-    begin();
-    return preferences.putInt(KEY_BIN_TYPE, static_cast<int>(type));
+    write([type](Snapshot& s) { s.binType = static_cast<int32_t>(type); });
+    return true;
 }
 
-int ConfigManager::getState() {
-    begin();
-    return preferences.getInt(KEY_STATE, 0);  // 0 = NO_COLLECTION
+bool ConfigManager::isLowPowerMode() {
+    return read<bool>([](const Snapshot& s) { return s.lowPower != 0; });
 }
 
-bool ConfigManager::setState(int state) {
-    begin();
-    return preferences.putInt(KEY_STATE, state);
+bool ConfigManager::setLowPowerMode(bool enabled) {
+    write([enabled](Snapshot& s) { s.lowPower = enabled ? 1 : 0; });
+    return true;
 }
 
-time_t ConfigManager::getCompletedTime() {
+bool ConfigManager::getLegacyState(int& state, time_t& completedTime) {
     begin();
-    return preferences.getInt(KEY_COMPLETED_TIME, 0);
-}
-
-bool ConfigManager::setCompletedTime(time_t time) {
-    begin();
-    return preferences.putInt(KEY_COMPLETED_TIME, time);
+    state = legacyState;
+    completedTime = legacyCompletedTime;
+    return hasLegacyState;
 }
 
 #ifdef TESTING
 void ConfigManager::clearForTesting() {
-    begin();
-    preferences.remove(KEY_WIFI_SSID);
-    preferences.remove(KEY_WIFI_PASS);
-    preferences.remove(KEY_FORCE_SETUP);
-    preferences.remove(KEY_CALENDAR_ID);
-    preferences.remove(KEY_BIN_TAKEN_OUT);
-    preferences.remove(KEY_BIN_TYPE);
-    preferences.remove(KEY_STATE);
-    preferences.remove(KEY_COMPLETED_TIME);
+    reset();
 }
 #endif
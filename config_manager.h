@@ -1,16 +1,32 @@
 #pragma once
 
 #include <Arduino.h>
+#include <atomic>
+#include <stddef.h>
 #ifdef ESP32
     #include <Preferences.h>
 #else
     #include "Preferences.h"
 #endif
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
 #include "bin_type.h"
+#include "bindicator_state.h"
 
+// Settings live in NVS as one versioned, CRC-checked blob, read once into a
+// RAM snapshot. Getters copy out of it under a sequence lock, so any task can
+// read without blocking or touching flash. Setters update the snapshot and
+// mark it dirty; the flusher task writes the blob back a moment later, so a
+// burst of changes costs one NVS write. Call flush() before restarting or
+// sleeping.
 class ConfigManager {
     public:
         static void begin();
+        static void startFlusher();
+        static void flush();
+        static void reset();
+
         static void processSetupFlag();
         static bool isConfigured();
         static bool isInForcedSetupMode();
@@ -19,10 +35,9 @@ class ConfigManager {
         static String getCalendarId();
         static bool setCalendarId(const String& id);
 
-        static int getState();
-        static bool setState(int state);
-        static time_t getCompletedTime();
-        static bool setCompletedTime(time_t time);
+        // The Bindicator state saved by firmware before StateStore, if any was
+        // found while migrating from the old per-setting keys this boot
+        static bool getLegacyState(int& state, time_t& completedTime);
 
         static String getWifiSSID();
         static String getWifiPassword();
@@ -34,13 +49,28 @@ class ConfigManager {
         static BinType getBinType();
         static bool setBinType(BinType type);
 
+        static bool isLowPowerMode();
+        static bool setLowPowerMode(bool enabled);
+
+        static uint32_t getFlushCount() { return flushCount; }
+
         #ifdef TESTING
         static void clearForTesting();
+        static void reloadForTesting() { load(); }
+        static Preferences& storageForTesting() { return preferences; }
         #endif
 
     private:
-        static Preferences preferences;
+        // Let a burst of changes land before writing them out together
+        static const uint32_t FLUSH_DELAY_MS = 2000;
+
+        // Bump when Snapshot changes; new fields go on the end so older
+        // blobs still load, with the new fields left at their defaults
+        static const uint16_t CONFIG_VERSION = 1;
+
         static const char* PREF_NAMESPACE;
+        static const char* KEY_CONFIG;
+        // The per-setting keys used before the blob, read once to migrate
         static const char* KEY_CALENDAR_ID;
         static const char* KEY_STATE;
         static const char* KEY_COMPLETED_TIME;
@@ -49,4 +79,55 @@ class ConfigManager {
         static const char* KEY_WIFI_PASS;
         static const char* KEY_BIN_TAKEN_OUT;
         static const char* KEY_BIN_TYPE;
+        static const char* KEY_LOW_POWER;
+
+        // Laid out without padding so the CRC covers only real bytes
+        struct Snapshot {
+            int64_t binTakenOut;   // time_t, which outgrows 32 bits in 2038
+            int32_t binType;
+            char wifiSsid[33];
+            char wifiPassword[65];
+            char calendarId[128];
+            char forceSetup[32];
+            uint8_t lowPower;
+            uint8_t reserved;
+        };
+        static_assert(sizeof(Snapshot) == 272, "ConfigManager::Snapshot has padding");
+
+        // Stored up to and including crc; the struct's own tail padding isn't
+        struct StoredConfig {
+            uint16_t version;
+            uint16_t length;       // sizeof(Snapshot) in the firmware that wrote it
+            uint32_t reserved;     // Keeps settings 8-aligned without hidden padding
+            Snapshot settings;
+            uint32_t crc;          // Over the header and the first length bytes of settings
+        };
+        static_assert(offsetof(StoredConfig, settings) == 8, "ConfigManager::StoredConfig has padding");
+
+        static Preferences preferences;
+        static Snapshot snapshot;
+        static std::atomic<uint32_t> sequence;
+        static SemaphoreHandle_t writeLock;
+        static SemaphoreHandle_t flushLock;
+        static TaskHandle_t flusherTask;
+        static bool dirty;
+        static uint32_t flushCount;
+        static bool loaded;
+        static bool hasLegacyState;
+        static int legacyState;
+        static time_t legacyCompletedTime;
+        static bool legacyKeysPending;
+
+        template <typename T, typename Field>
+        static T read(Field field);
+        template <typename Change>
+        static void write(Change change, bool persist = true);
+
+        static bool copyString(char* dest, size_t size, const String& value, const char* name);
+        static Snapshot defaults();
+        static void load();
+        static bool loadBlob(Snapshot& settings);
+        static void migrateFromKeys(Snapshot& settings);
+        static uint32_t checksum(const StoredConfig& stored, size_t length);
+        static void flusherLoop(void* parameter);
 };
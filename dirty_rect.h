@@ -0,0 +1,32 @@
+#ifndef DIRTY_RECT_H
+#define DIRTY_RECT_H
+
+#include <stdint.h>
+
+// Bounding box of the pixels touched since the last composite, inclusive
+// on all sides; empty when left > right.
+struct DirtyRect {
+    uint8_t left = UINT8_MAX;
+    uint8_t top = UINT8_MAX;
+    uint8_t right = 0;
+    uint8_t bottom = 0;
+
+    bool isEmpty() const { return left > right; }
+
+    void reset() { *this = DirtyRect(); }
+
+    void include(uint8_t x, uint8_t y) {
+        if (x < left) left = x;
+        if (x > right) right = x;
+        if (y < top) top = y;
+        if (y > bottom) bottom = y;
+    }
+
+    void include(const DirtyRect& other) {
+        if (other.isEmpty()) return;
+        include(other.left, other.top);
+        include(other.right, other.bottom);
+    }
+};
+
+#endif
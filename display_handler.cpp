@@ -1,13 +1,35 @@
 #include "display_handler.h"
+#include "brightness_table.h"
+
+static constexpr BrightnessTable WAVE_LEVELS(false);
+static constexpr PixelMap<BoardMatrix> PIXEL_MAP;
 
 DisplayHandler::DisplayHandler(uint8_t pin)
     : matrix(MATRIX_WIDTH * MATRIX_HEIGHT, pin, NEO_RGB + NEO_KHZ800),
       isPulsing(false),
       lastPulseUpdate(0),
       pulseValue(MIN_BRIGHTNESS),
-      pulseIncreasing(true) {
+      pulseIncreasing(true),
+      layers(),
+      activeLayer(LAYER_SCENE),
+      composite(),
+      framesShown(0),
+      framesSkipped(0),
+      lastSubmitUs(0),
+      maxSubmitUs(0)
+#ifdef ESP32
+      , output(pin, MATRIX_WIDTH * MATRIX_HEIGHT),
+      useRmt(false)
+#endif
+{
 }
 
+const uint32_t DisplayHandler::PULSE_PERIOD_MS;
+const uint8_t DisplayHandler::LAYER_SCENE;
+const uint8_t DisplayHandler::LAYER_OVERLAY;
+const uint8_t DisplayHandler::LAYER_COUNT;
+const uint16_t DisplayHandler::PIXELS;
+
 void DisplayHandler::begin() {
     matrix.begin();
     matrix.setBrightness(BRIGHTNESS);
@@ -16,21 +38,103 @@ void DisplayHandler::begin() {
     for(int i = 0; i < MATRIX_WIDTH * MATRIX_HEIGHT; i++) {
         matrix.setPixelColor(i, 0);
     }
-    matrix.show();
+
+#ifdef ESP32
+    // Falls back to the library's blocking show() if RMT can't be set up
+    useRmt = output.begin();
+#endif
+    show();
     delay(50);
 }
 
-// Add this helper method to rotate pixel coordinates 180 degrees
-uint16_t DisplayHandler::getRotatedPixel(uint16_t pixel) {
-    // For 8x8 matrix, rotate 180 degrees means:
-    // (x,y) becomes (7-x, 7-y)
+void DisplayHandler::show() {
+    unsigned long start = micros();
+#ifdef ESP32
+    if (useRmt) {
+        output.submit(matrix.getPixels());
+    } else {
+        matrix.show();
+    }
+#else
+    matrix.show();
+#endif
+    lastSubmitUs = micros() - start;
+    if (lastSubmitUs > maxSubmitUs) maxSubmitUs = lastSubmitUs;
+}
+
+void DisplayHandler::beginLayer(uint8_t layer) {
+    if (layer >= LAYER_COUNT) return;
+    activeLayer = layer;
+
+    Layer& target = layers[layer];
+    if (target.drawn.isEmpty()) return;
+
+    for (uint8_t y = target.drawn.top; y <= target.drawn.bottom; y++) {
+        for (uint8_t x = target.drawn.left; x <= target.drawn.right; x++) {
+            target.pixels[y * MATRIX_WIDTH + x] = 0;
+        }
+    }
+    target.dirty.include(target.drawn);
+    target.drawn.reset();
+}
+
+void DisplayHandler::setPixelColor(uint16_t pixel, uint32_t color) {
+    if (pixel >= PIXELS) return;
+
+    Layer& target = layers[activeLayer];
+    if (target.pixels[pixel] == color) return;
+
     uint8_t x = pixel % MATRIX_WIDTH;
     uint8_t y = pixel / MATRIX_WIDTH;
-    return ((MATRIX_HEIGHT - 1 - y) * MATRIX_WIDTH) + (MATRIX_WIDTH - 1 - x);
+    target.pixels[pixel] = color;
+    target.dirty.include(x, y);
+    if (color != 0) target.drawn.include(x, y);
 }
 
-void DisplayHandler::setPixelColor(uint16_t pixel, uint32_t color) {
-    matrix.setPixelColor(getRotatedPixel(pixel), color);
+// Visits only the lit pixels, lowest set bit first
+void DisplayHandler::blit(const Sprite& sprite, uint32_t color) {
+    for (uint64_t bits = sprite.bits; bits != 0; bits &= bits - 1) {
+        setPixelColor(__builtin_ctzll(bits), color);
+    }
+}
+
+// Rotation, mirroring and wiring are all folded into PIXEL_MAP on the way out
+bool DisplayHandler::showIfChanged() {
+    DirtyRect region;
+    for (uint8_t i = 0; i < LAYER_COUNT; i++) {
+        region.include(layers[i].dirty);
+        layers[i].dirty.reset();
+    }
+
+    bool changed = false;
+    if (!region.isEmpty()) {
+        for (uint8_t y = region.top; y <= region.bottom; y++) {
+            for (uint8_t x = region.left; x <= region.right; x++) {
+                uint16_t pixel = y * MATRIX_WIDTH + x;
+
+                // Topmost lit layer wins
+                uint32_t color = 0;
+                for (int i = LAYER_COUNT - 1; i >= 0 && color == 0; i--) {
+                    color = layers[i].pixels[pixel];
+                }
+
+                if (color != composite[pixel]) {
+                    composite[pixel] = color;
+                    matrix.setPixelColor(PIXEL_MAP[pixel], color);
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    if (!changed) {
+        framesSkipped++;
+        return false;
+    }
+
+    show();
+    framesShown++;
+    return true;
 }
 
 void DisplayHandler::update() {
@@ -41,21 +145,20 @@ void DisplayHandler::update() {
 
     lastPulseUpdate = currentMillis;
 
-    float t = (float)(currentMillis) / 40000.0;
-    float sine = sin(2 * PI * t);
-    float normalized = (sine + 1.0) / 2.0;
+    uint8_t level = WAVE_LEVELS.at(currentMillis, PULSE_PERIOD_MS);
 
-    uint8_t r = ((currentColor >> 16) & 0xFF) * normalized;
-    uint8_t g = ((currentColor >> 8) & 0xFF) * normalized;
-    uint8_t b = (currentColor & 0xFF) * normalized;
+    uint8_t r = BrightnessTable::scale((currentColor >> 16) & 0xFF, level);
+    uint8_t g = BrightnessTable::scale((currentColor >> 8) & 0xFF, level);
+    uint8_t b = BrightnessTable::scale(currentColor & 0xFF, level);
 
     uint32_t scaledColor = matrix.Color(r, g, b);
     fillScreen(scaledColor);
 }
 
 void DisplayHandler::fillScreen(uint32_t color) {
+    beginLayer(LAYER_SCENE);
     for(int i = 0; i < MATRIX_WIDTH * MATRIX_HEIGHT; i++) {
-        matrix.setPixelColor(i, color);
+        setPixelColor(i, color);
     }
-    matrix.show();
+    showIfChanged();
 }
@@ -2,21 +2,52 @@
 #define DISPLAY_HANDLER_H
 
 #include <Adafruit_NeoPixel.h>
+#include "sprite.h"
+#include "matrix_layout.h"
+#include "dirty_rect.h"
+#ifdef ESP32
+    #include "rmt_led_output.h"
+#endif
 
+// Drawing goes into RAM layers rather than the LED buffer. Black is
+// transparent, so an upper layer only covers what it lights. Each layer
+// tracks the region it has touched, and showIfChanged() recomposites just
+// those regions through the board's pixel map.
 class DisplayHandler {
     public:
+        static const uint8_t LAYER_SCENE = 0;     // the current state's animation
+        static const uint8_t LAYER_OVERLAY = 1;   // small indicators drawn over it
+        static const uint8_t LAYER_COUNT = 2;
+
         // Default to pin 14 as per Waveshare docs
         // https://www.waveshare.com/wiki/ESP32-S3-Matrix
         DisplayHandler(uint8_t pin = 14);
         void begin();
         void update();
+
+        // Empties a layer and sends later drawing to it
+        void beginLayer(uint8_t layer);
         void setPixelColor(uint16_t pixel, uint32_t color);
+        // Lights the sprite's pixels in one colour, leaving the rest as they are
+        void blit(const Sprite& sprite, uint32_t color);
+
+        // Composites the dirty regions and sends the frame to the LEDs if
+        // anything visible changed
+        bool showIfChanged();
+        // Sends the frame regardless; on the device this hands it to the RMT
+        // peripheral and returns before it has gone out
+        void show();
+        uint32_t getFramesShown() const { return framesShown; }
+        uint32_t getFramesSkipped() const { return framesSkipped; }
+        // Time spent handing a frame to the LED driver, in microseconds
+        uint32_t getLastSubmitUs() const { return lastSubmitUs; }
+        uint32_t getMaxSubmitUs() const { return maxSubmitUs; }
 
         Adafruit_NeoPixel matrix;
 
     private:
-        static const uint8_t MATRIX_WIDTH = 8;
-        static const uint8_t MATRIX_HEIGHT = 8;
+        static const uint8_t MATRIX_WIDTH = BoardMatrix::WIDTH;
+        static const uint8_t MATRIX_HEIGHT = BoardMatrix::HEIGHT;
 
         static const uint8_t MAX_BRIGHTNESS = 20;
         static const uint8_t MIN_BRIGHTNESS = 0;
@@ -25,6 +56,8 @@ class DisplayHandler {
         // see: https://www.waveshare.com/wiki/ESP32-S3-Matrix
         static const uint8_t BRIGHTNESS = MAX_BRIGHTNESS;
 
+        static const uint32_t PULSE_PERIOD_MS = 40000;
+
         void fillScreen(uint32_t color);
 
         uint32_t currentColor;
@@ -33,7 +66,26 @@ class DisplayHandler {
         uint8_t pulseValue;
         bool pulseIncreasing;
 
-        uint16_t getRotatedPixel(uint16_t pixel);
+        static const uint16_t PIXELS = MATRIX_WIDTH * MATRIX_HEIGHT;
+
+        struct Layer {
+            uint32_t pixels[PIXELS];
+            DirtyRect dirty;
+            DirtyRect drawn;   // everything lit since the layer was last emptied
+        };
+
+        Layer layers[LAYER_COUNT];
+        uint8_t activeLayer;
+        uint32_t composite[PIXELS];
+        uint32_t framesShown;
+        uint32_t framesSkipped;
+        uint32_t lastSubmitUs;
+        uint32_t maxSubmitUs;
+
+#ifdef ESP32
+        RmtLedOutput output;
+        bool useRmt;
+#endif
 };
 
 #endif
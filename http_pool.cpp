@@ -0,0 +1,203 @@
+#include "http_pool.h"
+
+const char* HttpPool::COLLECTED_HEADERS[] = {"ETag", "Transfer-Encoding"};
+
+HttpPool::Slot HttpPool::slots[MAX_HOSTS];
+SemaphoreHandle_t HttpPool::poolLock = nullptr;
+unsigned long HttpPool::useCounter = 0;
+std::atomic<uint32_t> HttpPool::handshakes(0);
+std::atomic<uint32_t> HttpPool::handshakesAvoided(0);
+
+void HttpBodyStream::begin(Stream& rawStream, bool isChunked, long length) {
+    raw = &rawStream;
+    chunked = isChunked;
+    remaining = isChunked ? 0 : length;
+    finished = !isChunked && length == 0;
+}
+
+// Reads (or with a null out, discards) the rest of the body
+bool HttpBodyStream::readAll(String* out) {
+    // A body without a length only ends when the server closes the socket
+    if (remaining < 0 && out == nullptr) return false;
+
+    unsigned long lastByte = millis();
+    while (!finished) {
+        int c = read();
+        if (c >= 0) {
+            if (out != nullptr) *out += static_cast<char>(c);
+            lastByte = millis();
+        } else if (millis() - lastByte >= READ_TIMEOUT_MS) {
+            return false;
+        } else {
+            delay(1);
+        }
+    }
+    return true;
+}
+
+int HttpBodyStream::available() {
+    if (!ready()) return 0;
+    int count = raw->available();
+    return remaining > 0 && count > remaining ? remaining : count;
+}
+
+int HttpBodyStream::read() {
+    if (!ready()) return -1;
+
+    int c = raw->read();
+    if (c >= 0 && remaining > 0) {
+        remaining--;
+        if (remaining == 0 && !chunked) finished = true;
+    }
+    return c;
+}
+
+int HttpBodyStream::peek() {
+    return ready() ? raw->peek() : -1;
+}
+
+// True when body bytes can be read now, moving on to the next chunk if needed
+bool HttpBodyStream::ready() {
+    if (raw == nullptr || finished) return false;
+    if (remaining != 0) return true;
+    return chunked && nextChunk();
+}
+
+bool HttpBodyStream::nextChunk() {
+    if (raw->available() <= 0) return false;
+
+    String line;
+    if (!readLine(line)) return false;
+    // The CRLF that closes the previous chunk's data
+    if (line.isEmpty() && !readLine(line)) return false;
+
+    remaining = strtol(line.c_str(), nullptr, 16);
+    if (remaining > 0) return true;
+
+    // Last chunk: skip any trailers up to the blank line
+    while (readLine(line) && !line.isEmpty()) {}
+    finished = true;
+    return false;
+}
+
+bool HttpBodyStream::readLine(String& line) {
+    line = "";
+    unsigned long start = millis();
+    while (millis() - start < READ_TIMEOUT_MS) {
+        int c = raw->read();
+        if (c < 0) {
+            delay(1);
+        } else if (c == '\n') {
+            return true;
+        } else if (c != '\r') {
+            line += static_cast<char>(c);
+        }
+    }
+    return false;
+}
+
+void HttpPool::begin() {
+    if (poolLock != nullptr) return;
+
+    poolLock = xSemaphoreCreateMutex();
+    for (int i = 0; i < MAX_HOSTS; i++) {
+        slots[i].lock = xSemaphoreCreateMutex();
+        // Matches the certificate handling HTTPClient::begin(url) used before
+        slots[i].client.setInsecure();
+        slots[i].http.setReuse(true);
+    }
+}
+
+// Finds (or takes over the least recently used) slot for host and locks it
+HttpPool::Slot& HttpPool::acquire(const String& host) {
+    begin();
+
+    xSemaphoreTake(poolLock, portMAX_DELAY);
+    Slot* slot = &slots[0];
+    for (int i = 0; i < MAX_HOSTS; i++) {
+        if (slots[i].host == host) {
+            slot = &slots[i];
+            break;
+        }
+        if (slots[i].lastUsed < slot->lastUsed) slot = &slots[i];
+    }
+    slot->lastUsed = ++useCounter;
+    xSemaphoreGive(poolLock);
+
+    xSemaphoreTake(slot->lock, portMAX_DELAY);
+    if (slot->host != host) {
+        slot->client.stop();
+        slot->host = host;
+    }
+    return *slot;
+}
+
+String HttpPool::hostOf(const String& url) {
+    int start = url.indexOf("://");
+    start = start < 0 ? 0 : start + 3;
+    int end = start;
+    while (end < (int)url.length() && url.charAt(end) != '/' && url.charAt(end) != ':') end++;
+    return url.substring(start, end);
+}
+
+HttpPool::Lease::Lease(const String& url)
+    : slot(&acquire(hostOf(url))) {
+    slot->http.begin(slot->client, url);
+    slot->http.collectHeaders(COLLECTED_HEADERS, 2);
+}
+
+// Leaves the connection ready for the next request, or closes it
+HttpPool::Lease::~Lease() {
+    if (responseCode > 0) {
+        body();
+        if (!bodyStream.readAll(nullptr)) slot->client.stop();
+    }
+    slot->http.end();
+    xSemaphoreGive(slot->lock);
+}
+
+int HttpPool::Lease::GET() {
+    return send("GET", "");
+}
+
+int HttpPool::Lease::POST(const String& payload) {
+    return send("POST", payload);
+}
+
+// A kept-alive socket may have been closed by the server while idle, so a
+// failed request on a reused connection is retried once on a fresh one
+int HttpPool::Lease::send(const char* method, const String& payload) {
+    bool reused = slot->client.connected();
+
+    responseCode = slot->http.sendRequest(method, payload);
+    if (responseCode < 0 && reused) {
+        Serial.println("Kept-alive connection dropped, reconnecting");
+        slot->client.stop();
+        reused = false;
+        responseCode = slot->http.sendRequest(method, payload);
+    }
+
+    if (reused) {
+        handshakesAvoided++;
+    } else {
+        handshakes++;
+    }
+    return responseCode;
+}
+
+Stream& HttpPool::Lease::body() {
+    if (!bodyOpened) {
+        bodyOpened = true;
+        bool chunked = slot->http.header("Transfer-Encoding").indexOf("chunked") >= 0;
+        bool empty = responseCode == 204 || responseCode == 304 || responseCode <= 0;
+        bodyStream.begin(slot->http.getStream(), chunked, empty ? 0 : slot->http.getSize());
+    }
+    return bodyStream;
+}
+
+String HttpPool::Lease::getString() {
+    String payload;
+    body();
+    bodyStream.readAll(&payload);
+    return payload;
+}
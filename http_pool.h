@@ -0,0 +1,90 @@
+#ifndef HTTP_POOL_H
+#define HTTP_POOL_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+
+// Reads a response body off the socket whatever its framing (Content-Length,
+// chunked, or until close), so keep-alive connections can be stream-parsed
+// and then drained for the next request.
+class HttpBodyStream : public Stream {
+    public:
+        void begin(Stream& raw, bool chunked, long length);
+        bool readAll(String* out);
+        bool isFinished() const { return finished; }
+
+        int available() override;
+        int read() override;
+        int peek() override;
+        size_t write(uint8_t) override { return 0; }
+
+    private:
+        static const unsigned long READ_TIMEOUT_MS = 5000;
+
+        Stream* raw = nullptr;
+        bool chunked = false;
+        bool finished = true;
+        // Bytes left in the body or current chunk; -1 means until close
+        long remaining = 0;
+
+        bool ready();
+        bool nextChunk();
+        bool readLine(String& line);
+};
+
+// Keeps one TLS connection per API host open between requests so repeat calls
+// skip the TCP and TLS handshakes. A Lease holds a host's connection for one
+// request; all body reads go through it so it can leave the socket clean.
+class HttpPool {
+    private:
+        struct Slot {
+            String host;
+            WiFiClientSecure client;
+            HTTPClient http;
+            SemaphoreHandle_t lock;
+            unsigned long lastUsed;
+        };
+
+    public:
+        class Lease {
+            public:
+                explicit Lease(const String& url);
+                ~Lease();
+
+                HTTPClient& http() { return slot->http; }
+                int GET();
+                int POST(const String& payload);
+                Stream& body();
+                String getString();
+
+            private:
+                Slot* slot;
+                HttpBodyStream bodyStream;
+                int responseCode = 0;
+                bool bodyOpened = false;
+
+                int send(const char* method, const String& payload);
+        };
+
+        static void begin();
+        static unsigned long getHandshakes() { return handshakes; }
+        static unsigned long getHandshakesAvoided() { return handshakesAvoided; }
+
+    private:
+        static const int MAX_HOSTS = 2;
+        static const char* COLLECTED_HEADERS[];
+
+        static Slot slots[MAX_HOSTS];
+        static SemaphoreHandle_t poolLock;
+        static unsigned long useCounter;
+        // Bumped by leases on different slots at once, outside poolLock
+        static std::atomic<uint32_t> handshakes;
+        static std::atomic<uint32_t> handshakesAvoided;
+
+        static Slot& acquire(const String& host);
+        static String hostOf(const String& url);
+};
+
+#endif
@@ -0,0 +1,176 @@
+#include "json_list_reader.h"
+
+JsonListReader::JsonListReader(Stream& stream)
+    : stream(stream) {}
+
+bool JsonListReader::read(JsonDocument& item, JsonDocument& itemFilter, ItemHandler onItem) {
+    nextPageToken = "";
+    nextSyncToken = "";
+
+    if (nextToken() != '{') {
+        Serial.println("JSON list: expected object");
+        return false;
+    }
+
+    if (peekToken() == '}') {
+        stream.read();
+        return true;
+    }
+
+    char key[MAX_KEY_LENGTH];
+    while (true) {
+        if (!readKey(key, sizeof(key)) || nextToken() != ':') {
+            Serial.println("JSON list: malformed key");
+            return false;
+        }
+
+        bool ok;
+        if (strcmp(key, "items") == 0) {
+            ok = readItems(item, itemFilter, onItem);
+        } else if (strcmp(key, "nextPageToken") == 0) {
+            ok = readString(nextPageToken);
+        } else if (strcmp(key, "nextSyncToken") == 0) {
+            ok = readString(nextSyncToken);
+        } else {
+            ok = skipValue();
+        }
+        if (!ok) return false;
+
+        int token = nextToken();
+        if (token == '}') return true;
+        if (token != ',') {
+            Serial.println("JSON list: expected ',' or '}'");
+            return false;
+        }
+    }
+}
+
+bool JsonListReader::readItems(JsonDocument& item, JsonDocument& itemFilter, ItemHandler onItem) {
+    if (nextToken() != '[') {
+        Serial.println("JSON list: items is not an array");
+        return false;
+    }
+
+    if (peekToken() == ']') {
+        stream.read();
+        return true;
+    }
+
+    while (true) {
+        item.clear();
+        DeserializationError error = deserializeJson(item, stream, DeserializationOption::Filter(itemFilter));
+        if (error) {
+            Serial.print("deserializeJson() failed: ");
+            Serial.println(error.c_str());
+            return false;
+        }
+
+        onItem(item);
+
+        int token = nextToken();
+        if (token == ']') return true;
+        if (token != ',') {
+            Serial.println("JSON list: expected ',' or ']'");
+            return false;
+        }
+    }
+}
+
+// Waits for the next character to arrive without consuming it
+int JsonListReader::peekChar() {
+    unsigned long start = millis();
+    while (millis() - start < READ_TIMEOUT_MS) {
+        int c = stream.peek();
+        if (c >= 0) return c;
+        delay(1);
+    }
+    return -1;
+}
+
+int JsonListReader::peekToken() {
+    while (true) {
+        int c = peekChar();
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') return c;
+        stream.read();
+    }
+}
+
+int JsonListReader::nextToken() {
+    int c = peekToken();
+    if (c >= 0) stream.read();
+    return c;
+}
+
+// Reads a quoted key, truncating anything longer than the buffer
+bool JsonListReader::readKey(char* key, size_t size) {
+    if (nextToken() != '"') return false;
+
+    size_t length = 0;
+    char c;
+    while (stream.readBytes(&c, 1) == 1) {
+        if (c == '"') {
+            key[length] = '\0';
+            return true;
+        }
+        if (c == '\\' && stream.readBytes(&c, 1) != 1) break;
+        if (length < size - 1) key[length++] = c;
+    }
+    return false;
+}
+
+bool JsonListReader::readString(String& value) {
+    if (nextToken() != '"') return false;
+
+    char c;
+    while (stream.readBytes(&c, 1) == 1) {
+        if (c == '"') return true;
+        if (c == '\\' && stream.readBytes(&c, 1) != 1) break;
+        value += c;
+    }
+    return false;
+}
+
+// Expects the opening quote to have been consumed already
+bool JsonListReader::skipString() {
+    char c;
+    while (stream.readBytes(&c, 1) == 1) {
+        if (c == '"') return true;
+        if (c == '\\' && stream.readBytes(&c, 1) != 1) break;
+    }
+    return false;
+}
+
+bool JsonListReader::skipValue() {
+    int token = peekToken();
+    if (token < 0) return false;
+
+    if (token == '"') {
+        stream.read();
+        return skipString();
+    }
+
+    if (token == '{' || token == '[') {
+        int depth = 0;
+        char c;
+        while (stream.readBytes(&c, 1) == 1) {
+            if (c == '"') {
+                if (!skipString()) return false;
+            } else if (c == '{' || c == '[') {
+                depth++;
+            } else if ((c == '}' || c == ']') && --depth == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Number or literal: stop at the delimiter, leaving it for the caller
+    while (true) {
+        int c = peekChar();
+        if (c < 0 || c == ',' || c == '}' || c == ']' ||
+            c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+            return true;
+        }
+        stream.read();
+    }
+}
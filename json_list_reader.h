@@ -0,0 +1,40 @@
+#ifndef JSON_LIST_READER_H
+#define JSON_LIST_READER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <functional>
+
+// Walks a Google API list response ({"kind": ..., "items": [...], ...}) straight
+// off the network stream. Each entry of "items" is deserialized through a filter
+// into a caller-supplied document and handed to the callback before the next one
+// is read, so peak memory is one filtered item no matter how long the list is.
+// The paging and sync tokens are kept; every other top-level field is skipped.
+class JsonListReader {
+    public:
+        typedef std::function<void(JsonDocument& item)> ItemHandler;
+
+        JsonListReader(Stream& stream);
+        bool read(JsonDocument& item, JsonDocument& itemFilter, ItemHandler onItem);
+        const String& getNextPageToken() const { return nextPageToken; }
+        const String& getNextSyncToken() const { return nextSyncToken; }
+
+    private:
+        static const unsigned long READ_TIMEOUT_MS = 5000;
+        static const size_t MAX_KEY_LENGTH = 32;
+
+        Stream& stream;
+        String nextPageToken;
+        String nextSyncToken;
+
+        int peekChar();
+        int peekToken();
+        int nextToken();
+        bool readKey(char* key, size_t size);
+        bool readItems(JsonDocument& item, JsonDocument& itemFilter, ItemHandler onItem);
+        bool readString(String& value);
+        bool skipString();
+        bool skipValue();
+};
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef MATRIX_LAYOUT_H
+#define MATRIX_LAYOUT_H
+
+#include <stdint.h>
+
+enum class Rotation {
+    NONE,
+    CW_90,
+    CW_180,
+    CW_270
+};
+
+enum class Wiring {
+    ROWS,        // every row runs left to right
+    SERPENTINE   // odd rows run right to left
+};
+
+// How a board's LED panel is mounted and wired, fixed at build time.
+// Logical (x, y) is what the animations draw in; led() gives the index of
+// the LED on the strip that shows it.
+template <int PANEL_WIDTH, int PANEL_HEIGHT, Rotation ROTATION,
+          Wiring WIRING = Wiring::ROWS, bool MIRRORED = false>
+struct MatrixLayout {
+    static const bool SWAPPED = ROTATION == Rotation::CW_90 || ROTATION == Rotation::CW_270;
+    static const int WIDTH = SWAPPED ? PANEL_HEIGHT : PANEL_WIDTH;
+    static const int HEIGHT = SWAPPED ? PANEL_WIDTH : PANEL_HEIGHT;
+    static const int PIXELS = PANEL_WIDTH * PANEL_HEIGHT;
+
+    static constexpr uint16_t led(int x, int y) {
+        int px = x, py = y;
+        switch (ROTATION) {
+            case Rotation::NONE:   break;
+            case Rotation::CW_90:  px = PANEL_WIDTH - 1 - y;  py = x; break;
+            case Rotation::CW_180: px = PANEL_WIDTH - 1 - x;  py = PANEL_HEIGHT - 1 - y; break;
+            case Rotation::CW_270: px = y;  py = PANEL_HEIGHT - 1 - x; break;
+        }
+        if (MIRRORED) px = PANEL_WIDTH - 1 - px;
+        if (WIRING == Wiring::SERPENTINE && (py & 1)) px = PANEL_WIDTH - 1 - px;
+        return py * PANEL_WIDTH + px;
+    }
+};
+
+template <int PW, int PH, Rotation R, Wiring W, bool M>
+const bool MatrixLayout<PW, PH, R, W, M>::SWAPPED;
+template <int PW, int PH, Rotation R, Wiring W, bool M>
+const int MatrixLayout<PW, PH, R, W, M>::WIDTH;
+template <int PW, int PH, Rotation R, Wiring W, bool M>
+const int MatrixLayout<PW, PH, R, W, M>::HEIGHT;
+template <int PW, int PH, Rotation R, Wiring W, bool M>
+const int MatrixLayout<PW, PH, R, W, M>::PIXELS;
+
+// Logical pixel -> LED index, worked out by the compiler so a pixel write
+// costs one table load whatever the board
+template <typename Layout>
+class PixelMap {
+    public:
+        constexpr PixelMap() : leds() {
+            for (int y = 0; y < Layout::HEIGHT; y++) {
+                for (int x = 0; x < Layout::WIDTH; x++) {
+                    leds[y * Layout::WIDTH + x] = Layout::led(x, y);
+                }
+            }
+        }
+
+        constexpr uint16_t operator[](uint16_t pixel) const { return leds[pixel]; }
+
+    private:
+        uint16_t leds[Layout::PIXELS];
+};
+
+// Boards in the fleet
+
+// Waveshare ESP32-S3-Matrix, mounted upside down in the enclosure
+// https://www.waveshare.com/wiki/ESP32-S3-Matrix
+typedef MatrixLayout<8, 8, Rotation::CW_180> WaveshareS3Matrix;
+
+// Generic 8x8 WS2812 panel with a serpentine data path
+typedef MatrixLayout<8, 8, Rotation::NONE, Wiring::SERPENTINE> Serpentine8x8;
+
+// Build with -DBINDICATOR_MATRIX=<layout> for other boards
+#ifndef BINDICATOR_MATRIX
+    #define BINDICATOR_MATRIX WaveshareS3Matrix
+#endif
+
+typedef BINDICATOR_MATRIX BoardMatrix;
+
+#endif
@@ -1,6 +1,17 @@
 #include "oauth_handler.h"
 #include <WiFi.h>
 #include "utils.h"
+#include "bin_schedule.h"
+#include "http_pool.h"
+#include "token_cache.h"
+
+const uint32_t OAuthHandler::DEFAULT_REFRESH_MARGIN_MS;
+const uint32_t OAuthHandler::REFRESH_RETRY_MS;
+const uint32_t OAuthHandler::WIFI_POLL_MS;
+const uint32_t OAuthHandler::REFRESH_MAX_SLEEP_MS;
+const uint32_t OAuthHandler::SAVED_TOKEN_WAIT_MS;
+const uint32_t OAuthHandler::MIN_SAVED_TOKEN_LIFE_S;
+const time_t OAuthHandler::MIN_VALID_EPOCH;
 
 OAuthHandler::OAuthHandler(const String& clientId, const String& clientSecret, const String& redirectUri)
     : GOOGLE_CLIENT_ID(clientId),
@@ -8,8 +19,16 @@ OAuthHandler::OAuthHandler(const String& clientId, const String& clientSecret, c
       GOOGLE_REDIRECT_URI(redirectUri) {}
 
 void OAuthHandler::begin(WebServer* server) {
+    TokenCache::begin();
+    if (refresh_token_lock == nullptr) {
+        refresh_token_lock = xSemaphoreCreateMutex();
+    }
+
     preferences.begin("oauth", false);
-    refresh_token = loadRefreshToken();
+    setRefreshToken(loadRefreshToken());
+    if (!hasValidToken()) {
+        restoreSavedToken();
+    }
 
     serverAvailable = (server != nullptr);
     if (serverAvailable) {
@@ -19,8 +38,29 @@ void OAuthHandler::begin(WebServer* server) {
 }
 
 bool OAuthHandler::isAuthorized() {
-    refresh_token = loadRefreshToken();
-    return !refresh_token.isEmpty();
+    return !getRefreshToken().isEmpty();
+}
+
+String OAuthHandler::getRefreshToken() {
+    xSemaphoreTake(refresh_token_lock, portMAX_DELAY);
+    String token = refresh_token;
+    xSemaphoreGive(refresh_token_lock);
+    return token;
+}
+
+void OAuthHandler::setRefreshToken(const String& token) {
+    xSemaphoreTake(refresh_token_lock, portMAX_DELAY);
+    refresh_token = token;
+    xSemaphoreGive(refresh_token_lock);
+
+    if (!token.isEmpty()) wakeRefreshTask();
+}
+
+// Releases a refresh task parked for want of a refresh token
+void OAuthHandler::wakeRefreshTask() {
+    if (refresh_task != nullptr) {
+        xTaskNotifyGive(refresh_task);
+    }
 }
 
 void OAuthHandler::handleOAuthRequest(WebServer* server) {
@@ -58,8 +98,8 @@ String OAuthHandler::getAuthUrl() {
 }
 
 bool OAuthHandler::exchangeAuthCode(const String& code, String& error) {
-    HTTPClient http;
-    http.begin(TOKEN_ENDPOINT);
+    HttpPool::Lease connection(TOKEN_ENDPOINT);
+    HTTPClient& http = connection.http();
     http.addHeader("Content-Type", "application/x-www-form-urlencoded");
 
     String post_data = "code=" + Utils::urlEncode(code);
@@ -68,80 +108,183 @@ bool OAuthHandler::exchangeAuthCode(const String& code, String& error) {
     post_data += "&redirect_uri=" + Utils::urlEncode(GOOGLE_REDIRECT_URI);
     post_data += "&grant_type=authorization_code";
 
-    int httpCode = http.POST(post_data);
+    int httpCode = connection.POST(post_data);
 
     if (httpCode == 200) {
-        String payload = http.getString();
+        String payload = connection.getString();
         DynamicJsonDocument doc(1024);
         deserializeJson(doc, payload);
 
-        refresh_token = doc["refresh_token"].as<String>();
-        access_token = doc["access_token"].as<String>();
-        int expires_in = doc["expires_in"];
-        token_expiry = millis() + (expires_in * 1000);
+        String token = doc["refresh_token"].as<String>();
+        setRefreshToken(token);
+        setAccessToken(doc["access_token"].as<String>(), doc["expires_in"]);
 
-        Serial.println("Received refresh token: " + refresh_token);
+        Serial.println("Received refresh token: " + token);
 
         preferences.begin("oauth", false);
-        bool saved = preferences.putString("refresh_token", refresh_token);
+        bool saved = preferences.putString("refresh_token", token);
         Serial.print("Saved refresh token status: ");
         Serial.println(saved ? "SUCCESS" : "FAILED");
         preferences.end();
 
-        http.end();
+        // The new account's "primary" calendar is not the one we cached
+        BinSchedule::invalidate();
+
         return true;
     }
 
-    http.end();
     return false;
 }
 
 bool OAuthHandler::getValidToken(String& token) {
-    if (access_token != "" && millis() < token_expiry) {
-        token = access_token;
-        return true;
+    // The saved token is tried first so a restart costs no token request
+    return TokenCache::get(token, [this]() {
+        return restoreSavedToken() || refreshAccessToken();
+    });
+}
+
+String OAuthHandler::getAccessToken() {
+    String token;
+    TokenCache::peek(token);
+    return token;
+}
+
+bool OAuthHandler::hasValidToken() {
+    String token;
+    return TokenCache::peek(token);
+}
+
+// Installs a newly issued token and saves it with a wall-clock expiry so it
+// survives a restart
+void OAuthHandler::setAccessToken(const String& token, int expiresInSeconds) {
+    uint32_t lifetimeS = expiresInSeconds > 0 ? expiresInSeconds : 0;
+    TokenCache::store(token, lifetimeS * 1000);
+
+    Preferences prefs;
+    prefs.begin("oauth", false);
+    time_t now = time(nullptr);
+    if (now >= MIN_VALID_EPOCH) {
+        prefs.putString("access_token", token);
+        prefs.putULong("token_expires", now + lifetimeS);
+    } else {
+        prefs.remove("access_token");
+        prefs.remove("token_expires");
     }
-    if (refreshAccessToken()) {
-        token = access_token;
-        return true;
+    prefs.end();
+}
+
+// Reuses the token saved before a restart if the wall clock says it's still good
+bool OAuthHandler::restoreSavedToken() {
+    time_t now = time(nullptr);
+    if (now < MIN_VALID_EPOCH) return false;
+
+    Preferences prefs;
+    prefs.begin("oauth", true);
+    String token = prefs.getString("access_token", "");
+    uint32_t expiresAt = prefs.getULong("token_expires", 0);
+    prefs.end();
+
+    if (token.isEmpty() || expiresAt < now + MIN_SAVED_TOKEN_LIFE_S) return false;
+
+    TokenCache::store(token, (expiresAt - now) * 1000);
+    Serial.println("Reusing access token saved before restart");
+    return true;
+}
+
+// A saved token can't be judged until NTP has set the clock
+bool OAuthHandler::savedTokenPending() {
+    if (hasValidToken() || restoreSavedToken()) return false;
+    if (time(nullptr) >= MIN_VALID_EPOCH) return false;
+
+    Preferences prefs;
+    prefs.begin("oauth", true);
+    bool saved = !prefs.getString("access_token", "").isEmpty();
+    prefs.end();
+    return saved;
+}
+
+void OAuthHandler::startBackgroundRefresh() {
+    if (refresh_task != nullptr) return;
+
+    xTaskCreatePinnedToCore(
+        refreshTask,
+        "TokenRefreshTask",
+        8192,
+        this,
+        1,
+        &refresh_task,
+        0
+    );
+}
+
+// Keeps a fresh access token in place so calendar checks never wait on the token endpoint
+void OAuthHandler::refreshTask(void* parameter) {
+    OAuthHandler* handler = static_cast<OAuthHandler*>(parameter);
+
+    uint32_t waitStart = millis();
+    while (handler->savedTokenPending() &&
+           Utils::msRemaining(waitStart, SAVED_TOKEN_WAIT_MS, millis()) > 0) {
+        vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+
+    while (true) {
+        uint32_t wait = TokenCache::msUntilRefresh(handler->refresh_margin_ms);
+        if (wait > 0) {
+            vTaskDelay(pdMS_TO_TICKS(wait < REFRESH_MAX_SLEEP_MS ? wait : REFRESH_MAX_SLEEP_MS));
+            continue;
+        }
+
+        // Unconfigured: nothing to refresh until a token is stored
+        if (handler->getRefreshToken().isEmpty()) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        // Offline isn't a failure; the refresh waits for the connection
+        if (WiFi.status() != WL_CONNECTED) {
+            vTaskDelay(pdMS_TO_TICKS(WIFI_POLL_MS));
+            continue;
+        }
+
+        if (!TokenCache::refresh([handler]() { return handler->refreshAccessToken(); })) {
+            Serial.println("Background token refresh failed, retrying");
+            vTaskDelay(pdMS_TO_TICKS(REFRESH_RETRY_MS));
+        }
     }
-    return false;
 }
 
 bool OAuthHandler::refreshAccessToken() {
-    if (refresh_token.length() == 0) return false;
+    String token = getRefreshToken();
+    if (token.length() == 0) return false;
 
-    HTTPClient http;
-    http.begin(TOKEN_ENDPOINT);
+    HttpPool::Lease connection(TOKEN_ENDPOINT);
+    HTTPClient& http = connection.http();
     http.addHeader("Content-Type", "application/x-www-form-urlencoded");
 
     String post_data = "client_id=" + GOOGLE_CLIENT_ID;
     post_data += "&client_secret=" + GOOGLE_CLIENT_SECRET;
-    post_data += "&refresh_token=" + refresh_token;
+    post_data += "&refresh_token=" + token;
     post_data += "&grant_type=refresh_token";
 
-    int httpCode = http.POST(post_data);
+    int httpCode = connection.POST(post_data);
 
     if (httpCode == 200) {
-        String payload = http.getString();
+        String payload = connection.getString();
         DynamicJsonDocument doc(1024);
         deserializeJson(doc, payload);
 
-        access_token = doc["access_token"].as<String>();
-        int expires_in = doc["expires_in"];
-        token_expiry = millis() + (expires_in * 1000);
+        setAccessToken(doc["access_token"].as<String>(), doc["expires_in"]);
 
-        http.end();
         return true;
     }
 
-    http.end();
     return false;
 }
 
 void OAuthHandler::saveRefreshToken(const String& token) {
     preferences.begin("oauth", false);
     preferences.putString("refresh_token", token);
+    setRefreshToken(token);
 }
 
 String OAuthHandler::loadRefreshToken() {
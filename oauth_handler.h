@@ -13,10 +13,12 @@ class OAuthHandler {
         void begin(WebServer* server = nullptr);
         void handleOAuthRequest(WebServer* server);
         bool exchangeAuthCode(const String& code, String& error);
-        String getAccessToken() { return access_token; }
-        bool hasValidToken() { return !access_token.isEmpty(); }
+        String getAccessToken();
+        bool hasValidToken();
         bool isAuthorized();
         bool getValidToken(String& token);
+        void startBackgroundRefresh();
+        void setRefreshMargin(uint32_t marginMs) { refresh_margin_ms = marginMs; }
         String getAuthUrl();
         String loadRefreshToken();
 
@@ -28,9 +30,25 @@ class OAuthHandler {
         const String TOKEN_ENDPOINT = "https://oauth2.googleapis.com/token";
         const String SCOPE = "https://www.googleapis.com/auth/calendar.readonly";
 
-        String access_token;
+        // Refresh this long before expiry, plus TokenCache's jitter
+        static const uint32_t DEFAULT_REFRESH_MARGIN_MS = 5 * 60 * 1000;
+        static const uint32_t REFRESH_RETRY_MS = 30 * 1000;
+        // How often the refresh task checks whether WiFi is back
+        static const uint32_t WIFI_POLL_MS = 5 * 1000;
+        // How long the refresh task waits for NTP before giving up on a saved token
+        static const uint32_t SAVED_TOKEN_WAIT_MS = 60 * 1000;
+        static const uint32_t MIN_SAVED_TOKEN_LIFE_S = 60;
+        // Anything earlier means the wall clock has not been set yet
+        static const time_t MIN_VALID_EPOCH = 1704067200;  // 2024-01-01
+        // pdMS_TO_TICKS overflows past ~71 minutes at a 1 kHz tick
+        static const uint32_t REFRESH_MAX_SLEEP_MS = 30 * 60 * 1000;
+
+        // Read by the refresh task while setup handlers replace it, so it's
+        // only touched through getRefreshToken()/setRefreshToken()
         String refresh_token;
-        unsigned long token_expiry;
+        SemaphoreHandle_t refresh_token_lock = nullptr;
+        uint32_t refresh_margin_ms = DEFAULT_REFRESH_MARGIN_MS;
+        TaskHandle_t refresh_task = nullptr;
         Preferences preferences;
         bool prefsInitialized = false;
         WebServer* server;
@@ -38,7 +56,14 @@ class OAuthHandler {
 
         void handleTokenRequest(WebServer* server);
         bool refreshAccessToken();
+        void setAccessToken(const String& token, int expiresInSeconds);
+        bool restoreSavedToken();
+        bool savedTokenPending();
+        static void refreshTask(void* parameter);
         void saveRefreshToken(const String& token);
+        String getRefreshToken();
+        void setRefreshToken(const String& token);
+        void wakeRefreshTask();
 };
 
 #endif
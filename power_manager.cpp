@@ -0,0 +1,108 @@
+#include "power_manager.h"
+#include "bindicator.h"
+#include "config_manager.h"
+#include "state_store.h"
+#ifdef ESP32
+    #include <driver/rtc_io.h>
+#else
+    #include "driver/rtc_io.h"
+#endif
+
+const uint32_t PowerManager::RTC_MAGIC = 0xB1D1CA70;
+
+RTC_DATA_ATTR PowerManager::RtcState PowerManager::rtc = {};
+uint8_t PowerManager::buttonPin = 0;
+esp_sleep_wakeup_cause_t PowerManager::wakeCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+unsigned long PowerManager::awakeSince = 0;
+
+void PowerManager::begin(uint8_t pin) {
+    buttonPin = pin;
+    awakeSince = millis();
+    wakeCause = esp_sleep_get_wakeup_cause();
+
+    if (!wokeFromSleep()) {
+        rtc = {};
+        return;
+    }
+
+    // The RTC keeps the wall clock running through deep sleep
+    time_t now = time(nullptr);
+    onWake(now > rtc.sleptAt ? (uint64_t)(now - rtc.sleptAt) * 1000 : 0);
+}
+
+bool PowerManager::isEnabled() {
+    return ConfigManager::isLowPowerMode();
+}
+
+void PowerManager::setEnabled(bool enabled) {
+    ConfigManager::setLowPowerMode(enabled);
+    Serial.printf("Low power mode %s\n", enabled ? "enabled" : "disabled");
+}
+
+bool PowerManager::wokeFromSleep() {
+    return rtc.magic == RTC_MAGIC &&
+           (wakeCause == ESP_SLEEP_WAKEUP_TIMER || wakeCause == ESP_SLEEP_WAKEUP_EXT0);
+}
+
+bool PowerManager::wokeByButton() {
+    return wokeFromSleep() && wakeCause == ESP_SLEEP_WAKEUP_EXT0;
+}
+
+// Puts Bindicator back where it was before the sleep; false after a cold boot
+bool PowerManager::restoreState() {
+    if (!wokeFromSleep()) return false;
+
+    Bindicator::restoreState(static_cast<BindicatorState>(rtc.bindicatorState), rtc.completedTime);
+    return true;
+}
+
+// Never returns on the device: waking from deep sleep starts again from setup()
+void PowerManager::deepSleep(uint32_t ms) {
+    rtc.magic = RTC_MAGIC;
+    rtc.bindicatorState = static_cast<uint8_t>(Bindicator::getState());
+    rtc.completedTime = Bindicator::getCompletedTime();
+    rtc.sleptAt = time(nullptr);
+    rtc.sleeps++;
+    rtc.awakeMs += millis() - awakeSince;
+
+    ConfigManager::flush();
+    StateStore::flush();
+
+    Serial.printf("Deep sleeping for %lu s\n", (unsigned long)(ms / 1000));
+    Serial.flush();
+
+    esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+    rtc_gpio_pullup_en(static_cast<gpio_num_t>(buttonPin));
+    esp_sleep_enable_ext0_wakeup(static_cast<gpio_num_t>(buttonPin), 0);
+    esp_deep_sleep_start();
+
+    // Only reached in the simulator, whose deep sleep returns like a timer wake
+    wakeCause = esp_sleep_get_wakeup_cause();
+    awakeSince = millis();
+    onWake(ms);
+}
+
+void PowerManager::onWake(uint64_t sleptMs) {
+    rtc.asleepMs += sleptMs;
+    if (wakeCause == ESP_SLEEP_WAKEUP_EXT0) rtc.buttonWakes++;
+}
+
+float PowerManager::dutyCyclePercent() {
+    uint64_t awakeMs = rtc.awakeMs + (millis() - awakeSince);
+    uint64_t totalMs = awakeMs + rtc.asleepMs;
+    return totalMs > 0 ? 100.0f * awakeMs / totalMs : 100.0f;
+}
+
+void PowerManager::printReport() {
+    uint64_t awakeMs = rtc.awakeMs + (millis() - awakeSince);
+
+    Serial.println("\nPower Statistics:");
+    Serial.println("------------------");
+    Serial.printf("Low power mode:          %s\n", isEnabled() ? "on" : "off");
+    Serial.printf("Deep sleeps:             %lu\n", (unsigned long)rtc.sleeps);
+    Serial.printf("Woken by button:         %lu\n", (unsigned long)rtc.buttonWakes);
+    Serial.printf("Time awake:              %lu s\n", (unsigned long)(awakeMs / 1000));
+    Serial.printf("Time asleep:             %lu s\n", (unsigned long)(rtc.asleepMs / 1000));
+    Serial.printf("Duty cycle:              %.2f%%\n", dutyCyclePercent());
+    Serial.println("------------------");
+}
@@ -0,0 +1,48 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include <esp_sleep.h>
+#include "bindicator_state.h"
+
+// Optional low-power mode: between calendar checks the device deep sleeps,
+// waking on the RTC timer for the next planned check or on the button. What
+// has to survive the sleep is kept in RTC memory, along with the awake/asleep
+// totals behind the duty-cycle report.
+class PowerManager {
+    public:
+        static void begin(uint8_t buttonPin);
+        static bool isEnabled();
+        static void setEnabled(bool enabled);
+
+        static bool wokeFromSleep();
+        static bool wokeByButton();
+        static bool restoreState();
+        static void deepSleep(uint32_t ms);
+
+        static float dutyCyclePercent();
+        static void printReport();
+
+    private:
+        static const uint32_t RTC_MAGIC;
+
+        struct RtcState {
+            uint32_t magic;
+            uint8_t bindicatorState;
+            time_t completedTime;
+            time_t sleptAt;
+            uint32_t sleeps;
+            uint32_t buttonWakes;
+            uint64_t awakeMs;
+            uint64_t asleepMs;
+        };
+
+        static RtcState rtc;
+        static uint8_t buttonPin;
+        static esp_sleep_wakeup_cause_t wakeCause;
+        static unsigned long awakeSince;
+
+        static void onWake(uint64_t sleptMs);
+};
+
+#endif
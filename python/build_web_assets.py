@@ -0,0 +1,117 @@
+"""Minifies and gzips the setup UI in web/ into web_assets.h.
+
+The setup server sends these bytes straight from flash with
+Content-Encoding: gzip, so nothing is built or compressed on the device.
+Run from the repo root, or via `make web-assets`.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUTPUT = os.path.join(ROOT, "web_assets.h")
+
+# The hashed CSS/JS URLs never change content, so they can be cached for a
+# year; pages at fixed URLs are revalidated against their ETag instead
+IMMUTABLE = "public, max-age=31536000, immutable"
+REVALIDATE = "no-cache"
+
+# (file, served path or None for pages only sent by handlers, C name, type)
+ASSETS = [
+    ("setup.css", "/setup.css", "WEB_SETUP_CSS", "text/css"),
+    ("setup.js", "/setup.js", "WEB_SETUP_JS", "application/javascript"),
+    ("index.html", "/", "WEB_INDEX_HTML", "text/html"),
+    ("wifi_saved.html", None, "WEB_WIFI_SAVED_HTML", "text/html"),
+    ("calendar_saved.html", None, "WEB_CALENDAR_SAVED_HTML", "text/html"),
+]
+
+
+def minify(text):
+    """Conservative: drops comments, indentation and blank lines only."""
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if line and not line.startswith("//"):
+            lines.append(line)
+    # Newlines kept so JavaScript statement boundaries survive
+    return "\n".join(lines) + "\n"
+
+
+def etag(data):
+    return '"' + hashlib.sha256(data).hexdigest()[:16] + '"'
+
+
+def c_array(name, data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "static const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, "\n".join(rows))
+
+
+def main():
+    built = []
+    hashes = {}
+    for filename, path, name, content_type in ASSETS:
+        with open(os.path.join(WEB_DIR, filename), encoding="utf-8") as f:
+            text = minify(f.read())
+
+        # Point pages at the exact CSS/JS they were built with
+        for asset_path, digest in hashes.items():
+            text = text.replace('"%s"' % asset_path, '"%s?v=%s"' % (asset_path, digest))
+
+        raw = text.encode("utf-8")
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        tag = etag(packed)
+        if path is not None and filename.endswith((".css", ".js")):
+            hashes[path] = tag.strip('"')
+            cache = IMMUTABLE
+        else:
+            cache = REVALIDATE
+        built.append((filename, path, name, content_type, raw, packed, tag, cache))
+
+    out = [
+        "// Generated by python/build_web_assets.py from web/ - do not edit",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset {",
+        "    const char* path;          // nullptr for pages only sent by handlers",
+        "    const char* contentType;",
+        "    const char* etag;",
+        "    const char* cacheControl;",
+        "    const uint8_t* gzipped;",
+        "    size_t length;",
+        "};",
+        "",
+    ]
+    for filename, path, name, content_type, raw, packed, tag, cache in built:
+        out.append("// %s: %d bytes minified, %d gzipped" % (filename, len(raw), len(packed)))
+        out.append(c_array(name + "_GZ", packed))
+
+    for filename, path, name, content_type, raw, packed, tag, cache in built:
+        out.append("static const WebAsset %s = {%s, \"%s\", \"%s\", \"%s\", %s_GZ, sizeof(%s_GZ)};" % (
+            name, '"%s"' % path if path else "nullptr", content_type,
+            tag.replace('"', '\\"'), cache, name, name))
+
+    served = [name for filename, path, name, *_ in built if path is not None]
+    out.append("")
+    out.append("static const WebAsset* const WEB_ROUTES[] = {%s};" % ", ".join("&" + n for n in served))
+    out.append("")
+    out.append("#endif")
+
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+
+    for filename, path, name, content_type, raw, packed, *_ in built:
+        print("%-20s %6d -> %5d bytes" % (filename, len(raw), len(packed)))
+
+
+if __name__ == "__main__":
+    main()
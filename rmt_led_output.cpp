@@ -0,0 +1,176 @@
+#include "rmt_led_output.h"
+
+#ifdef ESP32
+
+#if ESP_ARDUINO_VERSION_MAJOR < 3
+#error "RmtLedOutput needs the IDF 5 RMT driver (arduino-esp32 3.x)"
+#endif
+
+const uint32_t RmtLedOutput::RESOLUTION_HZ;
+const size_t RmtLedOutput::MEM_BLOCK_SYMBOLS;
+const uint32_t RmtLedOutput::LATCH_NS;
+
+// WS2812 bit as RMT ticks: high for highNs, then low for lowNs
+rmt_symbol_word_t RmtLedOutput::wsBit(uint32_t highNs, uint32_t lowNs) {
+    rmt_symbol_word_t symbol = {};
+    symbol.level0 = 1;
+    symbol.duration0 = highNs * (RESOLUTION_HZ / 1000000) / 1000;
+    symbol.level1 = 0;
+    symbol.duration1 = lowNs * (RESOLUTION_HZ / 1000000) / 1000;
+    return symbol;
+}
+
+RmtLedOutput::RmtLedOutput(uint8_t pin, uint16_t numLeds)
+    : pin(pin), frameBytes(numLeds * 3), buffers(), backBuffer(0), submitLock(nullptr), idle(nullptr),
+      channel(nullptr), frameEncoder(), started(false) {}
+
+bool RmtLedOutput::begin() {
+    if (started) return true;
+
+    rmt_tx_channel_config_t channelConfig = {};
+    channelConfig.gpio_num = static_cast<gpio_num_t>(pin);
+    channelConfig.clk_src = RMT_CLK_SRC_DEFAULT;
+    channelConfig.resolution_hz = RESOLUTION_HZ;
+    channelConfig.mem_block_symbols = MEM_BLOCK_SYMBOLS;
+    channelConfig.trans_queue_depth = 1;
+    #if SOC_RMT_SUPPORT_DMA
+    // The S3's RMT reads the frame over DMA; the original ESP32 has no RMT
+    // DMA and refills its channel memory from the interrupt instead
+    channelConfig.flags.with_dma = 1;
+    #endif
+
+    // Expands each byte into eight symbols, most significant bit first
+    rmt_bytes_encoder_config_t encoderConfig = {};
+    encoderConfig.bit0 = wsBit(350, 1000);
+    encoderConfig.bit1 = wsBit(1000, 350);
+    encoderConfig.flags.msb_first = 1;
+
+    if (rmt_new_tx_channel(&channelConfig, &channel) != ESP_OK) {
+        Serial.println("RMT LED output: no free TX channel");
+        return false;
+    }
+
+    rmt_copy_encoder_config_t copyConfig = {};
+    frameEncoder.base.encode = encodeFrame;
+    frameEncoder.base.reset = resetFrame;
+    frameEncoder.base.del = deleteFrame;
+    // Low for both halves; a zero-length half would end the transmission
+    frameEncoder.latch = wsBit(0, LATCH_NS);
+    frameEncoder.latch.duration0 = frameEncoder.latch.duration1 / 2;
+    frameEncoder.latch.duration1 -= frameEncoder.latch.duration0;
+    frameEncoder.latch.level0 = 0;
+
+    if (rmt_new_bytes_encoder(&encoderConfig, &frameEncoder.bytes) != ESP_OK ||
+        rmt_new_copy_encoder(&copyConfig, &frameEncoder.copy) != ESP_OK) {
+        Serial.println("RMT LED output: encoder setup failed");
+        rmt_del_channel(channel);
+        return false;
+    }
+
+    buffers[0] = static_cast<uint8_t*>(calloc(frameBytes, 1));
+    buffers[1] = static_cast<uint8_t*>(calloc(frameBytes, 1));
+    submitLock = xSemaphoreCreateMutex();
+    idle = xSemaphoreCreateBinary();
+    if (!buffers[0] || !buffers[1] || !submitLock || !idle) {
+        Serial.println("RMT LED output: out of memory");
+        return false;
+    }
+    xSemaphoreGive(idle);
+
+    rmt_tx_event_callbacks_t callbacks = {};
+    callbacks.on_trans_done = onTransmitDone;
+    if (rmt_tx_register_event_callbacks(channel, &callbacks, this) != ESP_OK ||
+        rmt_enable(channel) != ESP_OK) {
+        Serial.println("RMT LED output: channel enable failed");
+        return false;
+    }
+
+    started = true;
+    return true;
+}
+
+bool RmtLedOutput::submit(const uint8_t* pixels) {
+    if (!started) return false;
+
+    if (xSemaphoreTake(submitLock, TX_TIMEOUT_TICKS) != pdTRUE) {
+        Serial.println("RMT LED output: another frame is being submitted");
+        return false;
+    }
+
+    // The back buffer is never the one being transmitted, so it's free to fill
+    uint8_t* frame = buffers[backBuffer];
+    memcpy(frame, pixels, frameBytes);
+
+    // Only waits if the previous frame is somehow still going out
+    bool sent = false;
+    if (xSemaphoreTake(idle, TX_TIMEOUT_TICKS) != pdTRUE) {
+        Serial.println("RMT LED output: previous frame still sending");
+    } else {
+        rmt_transmit_config_t transmitConfig = {};
+        sent = rmt_transmit(channel, &frameEncoder.base, frame, frameBytes, &transmitConfig) == ESP_OK;
+        if (sent) {
+            backBuffer ^= 1;
+        } else {
+            xSemaphoreGive(idle);
+        }
+    }
+
+    xSemaphoreGive(submitLock);
+    return sent;
+}
+
+bool IRAM_ATTR RmtLedOutput::onTransmitDone(rmt_channel_handle_t channel,
+                                            const rmt_tx_done_event_data_t* event, void* arg) {
+    RmtLedOutput* output = static_cast<RmtLedOutput*>(arg);
+
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    xSemaphoreGiveFromISR(output->idle, &higherPriorityTaskWoken);
+    return higherPriorityTaskWoken == pdTRUE;
+}
+
+// Called by the driver each time the channel memory needs refilling; picks
+// up where the last call stopped, bytes first and then the latch
+size_t IRAM_ATTR RmtLedOutput::encodeFrame(rmt_encoder_t* encoder, rmt_channel_handle_t channel,
+                                           const void* data, size_t size, rmt_encode_state_t* state) {
+    FrameEncoder* frame = __containerof(encoder, FrameEncoder, base);
+    rmt_encode_state_t step = RMT_ENCODING_RESET;
+    int result = RMT_ENCODING_RESET;
+    size_t symbols = 0;
+
+    if (frame->stage == 0) {
+        symbols += frame->bytes->encode(frame->bytes, channel, data, size, &step);
+        if (step & RMT_ENCODING_COMPLETE) frame->stage = 1;
+        if (step & RMT_ENCODING_MEM_FULL) {
+            *state = static_cast<rmt_encode_state_t>(result | RMT_ENCODING_MEM_FULL);
+            return symbols;
+        }
+    }
+
+    symbols += frame->copy->encode(frame->copy, channel, &frame->latch, sizeof(frame->latch), &step);
+    if (step & RMT_ENCODING_COMPLETE) {
+        frame->stage = 0;
+        result |= RMT_ENCODING_COMPLETE;
+    }
+    if (step & RMT_ENCODING_MEM_FULL) result |= RMT_ENCODING_MEM_FULL;
+
+    *state = static_cast<rmt_encode_state_t>(result);
+    return symbols;
+}
+
+esp_err_t RmtLedOutput::resetFrame(rmt_encoder_t* encoder) {
+    FrameEncoder* frame = __containerof(encoder, FrameEncoder, base);
+    rmt_encoder_reset(frame->bytes);
+    rmt_encoder_reset(frame->copy);
+    frame->stage = 0;
+    return ESP_OK;
+}
+
+// The encoder is a member, so only its two parts are freed
+esp_err_t RmtLedOutput::deleteFrame(rmt_encoder_t* encoder) {
+    FrameEncoder* frame = __containerof(encoder, FrameEncoder, base);
+    rmt_del_encoder(frame->bytes);
+    rmt_del_encoder(frame->copy);
+    return ESP_OK;
+}
+
+#endif
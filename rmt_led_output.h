@@ -0,0 +1,74 @@
+#ifndef RMT_LED_OUTPUT_H
+#define RMT_LED_OUTPUT_H
+
+#ifdef ESP32
+
+#include <Arduino.h>
+#include <driver/rmt_tx.h>
+#include <soc/soc_caps.h>
+
+// Sends WS2812 frames through the RMT peripheral in the background. Frames
+// are copied into whichever of two buffers isn't on the wire and the
+// transmission is started without waiting for it; the end-of-transmission
+// callback frees the channel for the next one. Unlike a bit-banged show(),
+// the caller keeps running and interrupts stay enabled.
+//
+// Uses the IDF 5 RMT driver (driver/rmt_tx.h), the same one the 3.x core
+// and Adafruit_NeoPixel use. IDF 5 refuses to boot with the legacy
+// driver/rmt.h linked alongside it.
+class RmtLedOutput {
+    public:
+        RmtLedOutput(uint8_t pin, uint16_t numLeds);
+        bool begin();
+        // Pixels in wire (GRB/RGB) order, 3 bytes per LED
+        bool submit(const uint8_t* pixels);
+
+    private:
+        // 25 ns per tick
+        static const uint32_t RESOLUTION_HZ = 40000000;
+        // With DMA the symbols stream from RAM, so a bigger block means fewer
+        // refills; without it this is the channel's own RMT memory
+        #if SOC_RMT_SUPPORT_DMA
+        static const size_t MEM_BLOCK_SYMBOLS = 1024;
+        #else
+        static const size_t MEM_BLOCK_SYMBOLS = 64;
+        #endif
+        // WS2812s latch after 50-280 us of low; every frame ends with this
+        // much, so one sent straight after another isn't read as its tail
+        static const uint32_t LATCH_NS = 300000;
+        // Longer than a 64-LED frame (~2 ms) takes to go out
+        static const TickType_t TX_TIMEOUT_TICKS = pdMS_TO_TICKS(20);
+
+        const uint8_t pin;
+        const size_t frameBytes;
+        uint8_t* buffers[2];
+        int backBuffer;
+        // Held by a submit() from filling the back buffer until it's on the
+        // wire; the animation and button tasks both submit frames
+        SemaphoreHandle_t submitLock;
+        SemaphoreHandle_t idle;
+        // The pixel bytes, then the latch symbol, as one transmission
+        struct FrameEncoder {
+            rmt_encoder_t base;
+            rmt_encoder_handle_t bytes;
+            rmt_encoder_handle_t copy;
+            rmt_symbol_word_t latch;
+            int stage;
+        };
+
+        rmt_channel_handle_t channel;
+        FrameEncoder frameEncoder;
+        bool started;
+
+        static rmt_symbol_word_t wsBit(uint32_t highNs, uint32_t lowNs);
+        static size_t IRAM_ATTR encodeFrame(rmt_encoder_t* encoder, rmt_channel_handle_t channel,
+                                            const void* data, size_t size, rmt_encode_state_t* state);
+        static esp_err_t resetFrame(rmt_encoder_t* encoder);
+        static esp_err_t deleteFrame(rmt_encoder_t* encoder);
+        static bool IRAM_ATTR onTransmitDone(rmt_channel_handle_t channel,
+                                             const rmt_tx_done_event_data_t* event, void* arg);
+};
+
+#endif
+
+#endif
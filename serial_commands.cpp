@@ -1,4 +1,10 @@
 #include "serial_commands.h"
+#include "bin_schedule.h"
+#include "http_pool.h"
+#include "token_cache.h"
+#include "power_manager.h"
+#include "state_store.h"
+#include "display_handler.h"
 
 void SerialCommands::begin() {
     Serial.println("\nType 'help' for available commands");
@@ -21,21 +27,27 @@ void SerialCommands::handle() {
             showPreferences();
         } else if (command == "setup") {
             enterSetupMode();
+        } else if (command == "stats") {
+            showStats();
+        } else if (command == "power") {
+            PowerManager::printReport();
+        } else if (command == "lowpower") {
+            PowerManager::setEnabled(!PowerManager::isEnabled());
         }
     }
 }
 
 void SerialCommands::clearAllPreferences() {
-    Preferences systemPrefs;
-    systemPrefs.begin("system", false);
-    systemPrefs.clear();
-    systemPrefs.end();
+    ConfigManager::reset();
+    StateStore::clear();
 
     Preferences oauthPrefs;
     oauthPrefs.begin("oauth", false);
     oauthPrefs.clear();
     oauthPrefs.end();
 
+    BinSchedule::invalidate();
+
     Serial.println("All preferences cleared!");
     ESP.restart();
 }
@@ -46,7 +58,11 @@ void SerialCommands::clearOAuthPreferences() {
     oauthPrefs.clear();
     oauthPrefs.end();
 
+    // A different account may share the same calendar ID
+    BinSchedule::invalidate();
+
     Serial.println("OAuth preferences cleared!");
+    ConfigManager::flush();
     ESP.restart();
 }
 
@@ -56,6 +72,9 @@ void SerialCommands::showHelp() {
     Serial.println("clear_oauth - Clear only OAuth preferences and restart");
     Serial.println("prefs       - Show all stored preferences");
     Serial.println("setup       - Enter setup mode");
+    Serial.println("stats       - Show connection and display statistics");
+    Serial.println("power       - Show sleep statistics and duty cycle");
+    Serial.println("lowpower    - Toggle deep sleep between calendar checks");
     Serial.println("help        - Show this help message");
 }
 
@@ -66,14 +85,19 @@ void SerialCommands::printNamespace(const char* name) {
     Serial.printf("\n=== %s namespace ===\n", name);
 
     if (strcmp(name, "system") == 0) {
-        String ssid = prefs.getString("wifi_ssid", "");
-        String pass = prefs.getString("wifi_pass", "");
+        // Stored as one blob, so show what ConfigManager decoded from it
+        String ssid = ConfigManager::getWifiSSID();
+        String pass = ConfigManager::getWifiPassword();
         Serial.printf("wifi_ssid: %s\n", ssid.isEmpty() ? "(empty)" : ssid.c_str());
         Serial.printf("wifi_pass: %s\n", pass.isEmpty() ? "(empty)" : "(set)");
+        Serial.printf("calendar_id: %s\n", ConfigManager::getCalendarId().c_str());
     }
     else if (strcmp(name, "oauth") == 0) {
         String token = prefs.getString("refresh_token", "");
         Serial.printf("refresh_token: %s\n", token.isEmpty() ? "(empty)" : "(set)");
+        String accessToken = prefs.getString("access_token", "");
+        Serial.printf("access_token: %s (expires %lu)\n", accessToken.isEmpty() ? "(empty)" : "(set)",
+                      (unsigned long)prefs.getULong("token_expires", 0));
     }
 
     prefs.end();
@@ -89,10 +113,29 @@ void SerialCommands::showPreferences() {
     Serial.println("------------------");
 }
 
+void SerialCommands::showStats() {
+    Serial.println("\nStatistics:");
+    Serial.println("------------------");
+    Serial.printf("TLS handshakes:          %lu\n", HttpPool::getHandshakes());
+    Serial.printf("Handshakes avoided:      %lu\n", HttpPool::getHandshakesAvoided());
+    Serial.printf("Token refreshes:         %lu\n", TokenCache::getRefreshCount());
+
+    extern DisplayHandler display;
+    Serial.printf("Frames shown:            %lu\n", (unsigned long)display.getFramesShown());
+    Serial.printf("Frames skipped:          %lu\n", (unsigned long)display.getFramesSkipped());
+    Serial.printf("Frame submit (last/max): %lu/%lu us\n",
+                  (unsigned long)display.getLastSubmitUs(), (unsigned long)display.getMaxSubmitUs());
+    Serial.printf("State writes (today/all): %u/%lu\n",
+                  StateStore::getWritesToday(), (unsigned long)StateStore::getTotalWrites());
+    Serial.printf("State writes skipped:    %lu\n", (unsigned long)StateStore::getSkippedWrites());
+    Serial.println("------------------");
+}
+
 void SerialCommands::enterSetupMode() {
     Serial.println("Entering setup mode...");
 
     ConfigManager::setForcedSetupFlag("restart-in-setup-mode");
+    ConfigManager::flush();
 
     ESP.restart();
 }
@@ -2,6 +2,9 @@
 #include <WiFi.h>
 #include "config_manager.h"
 #include "calendar_handler.h"
+#include "bin_schedule.h"
+#include "state_store.h"
+#include "web_assets.h"
 
 SetupServer::SetupServer(OAuthHandler& oauth)
     : oauthHandler(oauth), server(nullptr) {
@@ -21,7 +24,11 @@ void SetupServer::begin() {
     config.wifi_ssid = ConfigManager::getWifiSSID();
     config.wifi_password = ConfigManager::getWifiPassword();
 
-    server->on("/", HTTP_GET, std::bind(&SetupServer::handleRoot, this));
+    // The UI is static and precompressed; only /status knows about the device
+    for (const WebAsset* asset : WEB_ROUTES) {
+        server->on(asset->path, HTTP_GET, [this, asset]() { sendAsset(*asset); });
+    }
+    server->on("/status", HTTP_GET, std::bind(&SetupServer::handleStatus, this));
     server->on("/save", HTTP_POST, std::bind(&SetupServer::handleSave, this));
     server->on("/oauth", HTTP_GET, [this]() {
         String authUrl = oauthHandler.getAuthUrl();
@@ -35,6 +42,9 @@ void SetupServer::begin() {
     server->on("/calendars", HTTP_GET, [this]() { this->handleCalendarList(); });
     server->on("/upcoming-bins", HTTP_GET, [this]() { this->handleUpcomingBins(); });
 
+    const char* headers[] = {"If-None-Match"};
+    server->collectHeaders(headers, 1);
+
     server->begin();
     Serial.println("Setup server started");
 }
@@ -45,69 +55,21 @@ void SetupServer::handleClient() {
 
 void SetupServer::handleSave() {
     if (server->hasArg("ssid") && server->hasArg("password")) {
-        config.wifi_ssid = server->arg("ssid");
-        config.wifi_password = server->arg("password");
+        String ssid = server->arg("ssid");
+        String password = server->arg("password");
+
+        // The page never sends the saved password back, so a blank one for
+        // the same network means keep it
+        if (!(password.isEmpty() && ssid == config.wifi_ssid)) {
+            config.wifi_password = password;
+        }
+        config.wifi_ssid = ssid;
 
         if (ConfigManager::setWifiCredentials(config.wifi_ssid, config.wifi_password)) {
             ConfigManager::setForcedSetupFlag("restart-in-setup-mode");
 
-            String html = R"html(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>WiFi Settings Saved</title>
-    <style>
-        body {
-            font-family: Arial, sans-serif;
-            max-width: 600px;
-            margin: 0 auto;
-            padding: 20px;
-            text-align: center;
-        }
-        @media (max-width: 640px) {
-            body { padding: 15px; }
-            h1 { font-size: 24px; }
-        }
-        .message {
-            margin: 20px 0;
-            padding: 20px;
-            border: 1px solid #4CAF50;
-            border-radius: 5px;
-        }
-        .urls { margin: 20px 0; }
-        .url {
-            font-family: monospace;
-            background: #f5f5f5;
-            padding: 5px 10px;
-            border-radius: 3px;
-            word-break: break-all;
-        }
-        @media (max-width: 400px) {
-            .message { padding: 15px; }
-            h1 { font-size: 22px; }
-        }
-    </style>
-</head>
-<body>
-    <h1>WiFi Settings Saved</h1>
-    <div class="message">
-        <p>WiFi configuration has been saved.</p>
-        <p>The device will now restart and enter setup mode to complete configuration.</p>
-        <p>When it's ready, you can complete setup at:</p>
-        <p class="url"><a href="http://bindicator.local">http://bindicator.local</a></p>
-        <p><small>(If bindicator.local doesn't work, you may need to find the device's IP address. The default is 192.168.4.1, but it may be different depending on your router.)</small></p>
-    </div>
-    <p>The device will restart in 5 seconds...</p>
-    <script>
-        setTimeout(function() {
-            document.body.innerHTML += '<p>Restarting...</p>';
-        }, 4000);
-    </script>
-</body>
-</html>)html";
-
-            server->send(200, "text/html", html);
+            sendAsset(WEB_WIFI_SAVED_HTML);
+            ConfigManager::flush();
             delay(5000);
             ESP.restart();
         } else {
@@ -118,8 +80,32 @@ void SetupServer::handleSave() {
     }
 }
 
-void SetupServer::handleRoot() {
-    server->send(200, "text/html", getSetupPage());
+// Sends a gzipped asset straight from flash, or 304 if the browser's copy is current
+void SetupServer::sendAsset(const WebAsset& asset) {
+    server->sendHeader("ETag", asset.etag);
+    server->sendHeader("Cache-Control", asset.cacheControl);
+
+    if (server->header("If-None-Match") == asset.etag) {
+        server->send(304);
+        return;
+    }
+
+    server->sendHeader("Content-Encoding", "gzip");
+    server->send_P(200, asset.contentType, reinterpret_cast<const char*>(asset.gzipped), asset.length);
+}
+
+// Everything the setup page shows about this device; never cached
+void SetupServer::handleStatus() {
+    StaticJsonDocument<384> status;
+    status["ssid"] = config.wifi_ssid;
+    status["wifiConnected"] = WiFi.status() == WL_CONNECTED;
+    status["authorized"] = oauthHandler.isAuthorized();
+    status["calendarId"] = ConfigManager::getCalendarId();
+
+    String response;
+    serializeJson(status, response);
+    server->sendHeader("Cache-Control", "no-store");
+    server->send(200, "application/json", response);
 }
 
 void SetupServer::handleOAuth() {
@@ -140,6 +126,7 @@ void SetupServer::handleOAuth() {
 
 void SetupServer::handleRestart() {
     server->send(200, "text/plain", "Restarting...");
+    ConfigManager::flush();
     delay(1000);
     ESP.restart();
 }
@@ -147,15 +134,16 @@ void SetupServer::handleRestart() {
 void SetupServer::handleFactoryReset() {
     server->send(200, "text/plain", "Performing factory reset...");
 
-    Preferences prefs;
-    prefs.begin("system", false);
-    prefs.clear();
-    prefs.end();
+    ConfigManager::reset();
+    StateStore::clear();
 
+    Preferences prefs;
     prefs.begin("oauth", false);
     prefs.clear();
     prefs.end();
 
+    BinSchedule::invalidate();
+
     delay(1000);
     ESP.restart();
 }
@@ -165,26 +153,7 @@ void SetupServer::handleSaveCalendar() {
         String calendarId = server->arg("calendar_id");
 
         if (ConfigManager::setCalendarId(calendarId)) {
-            String html = R"html(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>Calendar Settings Saved</title>
-    <style>
-        body { font-family: Arial, sans-serif; max-width: 600px; margin: 0 auto; padding: 20px; text-align: center; }
-        .message { margin: 20px 0; padding: 20px; border: 1px solid #4CAF50; border-radius: 5px; }
-    </style>
-</head>
-<body>
-    <h1>Calendar Settings Saved</h1>
-    <div class="message">
-        <p>Calendar ID has been updated successfully.</p>
-    </div>
-    <p><a href="/">Return to Setup</a></p>
-</body>
-</html>)html";
-
-            server->send(200, "text/html", html);
+            sendAsset(WEB_CALENDAR_SAVED_HTML);
         } else {
             server->send(500, "text/plain", "Failed to save calendar ID");
         }
@@ -193,19 +162,31 @@ void SetupServer::handleSaveCalendar() {
     }
 }
 
+// The lists are relayed item by item as chunked JSON, so neither the whole
+// Google response nor the whole reply is ever held in memory
 void SetupServer::handleCalendarList() {
     if (!oauthHandler.isAuthorized()) {
         server->send(401, "application/json", "{\"error\":\"Not authorized\"}");
         return;
     }
 
-    StaticJsonDocument<4096> calendars;
     CalendarHandler calendarHandler(oauthHandler);
+    bool started = false;
+    bool first = true;
+    int result = calendarHandler.streamCalendars(server->header("If-None-Match"),
+        [&](const String& etag) {
+            beginJsonList(etag);
+            started = true;
+        },
+        [&](JsonDocument& calendar) {
+            if (sendJsonListItem(calendar, first)) first = false;
+        });
 
-    if (calendarHandler.getAvailableCalendars(calendars)) {
-        String response;
-        serializeJson(calendars, response);
-        server->send(200, "application/json", response);
+    if (started) {
+        endJsonList(result == 200);
+    } else if (result == 304) {
+        server->sendHeader("ETag", server->header("If-None-Match"));
+        server->send(304);
     } else {
         server->send(500, "application/json", "{\"error\":\"Failed to fetch calendars\"}");
     }
@@ -217,14 +198,65 @@ void SetupServer::handleUpcomingBins() {
         return;
     }
 
-    StaticJsonDocument<4096> events;
+    // A multi-page listing's ETag only speaks for its first page
+    String ifNoneMatch = server->header("If-None-Match");
+    if (ifNoneMatch != upcomingBinsEtag) ifNoneMatch = "";
+
     CalendarHandler calendarHandler(oauthHandler);
+    bool started = false;
+    bool first = true;
+    bool singlePage = false;
+    String etag;
+    int result = calendarHandler.streamUpcomingBinDays(ifNoneMatch,
+        [&](const String& responseEtag) {
+            etag = responseEtag;
+            beginJsonList(etag);
+            started = true;
+        },
+        [&](JsonDocument& event) {
+            if (sendJsonListItem(event, first)) first = false;
+        },
+        singlePage);
 
-    if (calendarHandler.getUpcomingBinDays(events)) {
-        String response;
-        serializeJson(events, response);
-        server->send(200, "application/json", response);
+    if (result == 200) upcomingBinsEtag = singlePage ? etag : String("");
+
+    if (started) {
+        endJsonList(result == 200);
+    } else if (result == 304) {
+        server->sendHeader("ETag", ifNoneMatch);
+        server->send(304);
     } else {
         server->send(500, "application/json", "{\"error\":\"Failed to fetch events\"}");
     }
 }
+
+// Starts a chunked {"items":[...]} reply
+void SetupServer::beginJsonList(const String& etag) {
+    if (!etag.isEmpty()) server->sendHeader("ETag", etag);
+    server->sendHeader("Cache-Control", "no-cache");
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "application/json", "");
+    server->sendContent("{\"items\":[");
+}
+
+// Each item goes out as one chunk, comma included, from a stack buffer
+bool SetupServer::sendJsonListItem(JsonDocument& item, bool first) {
+    char chunk[JSON_CHUNK_SIZE];
+    size_t length = 0;
+    if (!first) chunk[length++] = ',';
+
+    if (measureJson(item) >= sizeof(chunk) - length) {
+        Serial.println("Skipping list item too large to send");
+        return false;
+    }
+    length += serializeJson(item, chunk + length, sizeof(chunk) - length);
+    server->sendContent(chunk, length);
+    return true;
+}
+
+// A list cut short is left unterminated, so the page sees invalid JSON
+// rather than a silently shortened list
+void SetupServer::endJsonList(bool complete) {
+    if (complete) server->sendContent("]}");
+    server->sendContent("");
+}
@@ -6,6 +6,8 @@
 #include "oauth_handler.h"
 #include "config_manager.h"
 
+struct WebAsset;
+
 class SetupServer {
     public:
         SetupServer(OAuthHandler& oauth);
@@ -17,6 +19,9 @@ class SetupServer {
         void handleUpcomingBins();
 
     private:
+        // Larger than any one filtered calendar or event
+        static const size_t JSON_CHUNK_SIZE = 512;
+
         OAuthHandler& oauthHandler;
 
         struct Config {
@@ -24,11 +29,17 @@ class SetupServer {
             String wifi_password;
         };
         Config config;
+        // ETag of the last /upcoming-bins reply that fitted one Google page;
+        // only that one can be revalidated against Google
+        String upcomingBinsEtag;
 
-        void handleRoot();
         void handleSave();
         void handleOAuth();
-        const char* getSetupPage();
+        void handleStatus();
+        void sendAsset(const WebAsset& asset);
+        void beginJsonList(const String& etag);
+        bool sendJsonListItem(JsonDocument& item, bool first);
+        void endJsonList(bool complete);
         void handleRestart();
         void handleFactoryReset();
         void handleSaveCalendar();
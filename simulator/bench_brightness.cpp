@@ -0,0 +1,74 @@
+// ABOUTME: Benchmarks the per-frame brightness maths of the pulsing animations
+// ABOUTME: Compares the old float sin() path with the compile-time lookup table
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include "brightness_table.h"
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define HAVE_RDTSC 1
+#endif
+
+static constexpr BrightnessTable PULSE_LEVELS(true);
+
+static const int FRAMES = 2000000;
+static const int PIXELS = 64;
+static const uint32_t FRAME_MS = 30;
+static const uint32_t PERIOD_MS = 3000;
+
+// The implementation Animations::calculateBrightness replaced
+static uint8_t floatBrightness(uint32_t elapsedMs) {
+    float phase = (elapsedMs % PERIOD_MS) / 3000.0;
+    float sinValue = (sin(2.0 * M_PI * phase) + 1.0) / 2.0;
+    float easedValue = sinValue * sinValue;
+    return (uint8_t)(easedValue * 255);
+}
+
+static uint8_t tableBrightness(uint32_t elapsedMs) {
+    return PULSE_LEVELS.at(elapsedMs, PERIOD_MS);
+}
+
+// One frame: the brightness for this instant, then every pixel scaled by it
+template <typename Brightness>
+static void runFrames(const char* name, Brightness brightness) {
+    volatile uint32_t sink = 0;
+
+#ifdef HAVE_RDTSC
+    uint64_t startCycles = __rdtsc();
+#endif
+    auto start = std::chrono::steady_clock::now();
+
+    for (int frame = 0; frame < FRAMES; frame++) {
+        uint8_t level = brightness(frame * FRAME_MS);
+        uint32_t frameSum = 0;
+        for (int pixel = 0; pixel < PIXELS; pixel++) {
+            frameSum += ((pixel & 0x3F) * level) / 64;
+        }
+        sink = sink + frameSum;
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count() / FRAMES;
+
+    std::cout << name << ": " << ns << " ns/frame";
+#ifdef HAVE_RDTSC
+    std::cout << ", " << (double)(__rdtsc() - startCycles) / FRAMES << " cycles/frame";
+#endif
+    std::cout << std::endl;
+}
+
+int main() {
+    int maxDiff = 0;
+    for (uint32_t ms = 0; ms < PERIOD_MS; ms++) {
+        int diff = std::abs(floatBrightness(ms) - tableBrightness(ms));
+        if (diff > maxDiff) maxDiff = diff;
+    }
+
+    std::cout << "Pulse brightness, " << FRAMES << " frames of " << PIXELS << " pixels" << std::endl;
+    runFrames("float sin() ", floatBrightness);
+    runFrames("lookup table", tableBrightness);
+    std::cout << "Largest difference from float: " << maxDiff << " levels" << std::endl;
+    return 0;
+}
@@ -7,6 +7,7 @@
 #include <unistd.h>
 #include "terminal_display.h"
 #include "mocks/Arduino.h"
+#include "power_manager.h"
 
 // Firmware entry points (defined in bindicator.ino)
 extern void setup();
@@ -56,8 +57,14 @@ int main(int argc, char** argv) {
             break;
         } else if (command == "help") {
             std::cout << "Available commands:" << std::endl;
-            std::cout << "  help  - Show this message" << std::endl;
-            std::cout << "  quit  - Exit simulator" << std::endl;
+            std::cout << "  help      - Show this message" << std::endl;
+            std::cout << "  lowpower  - Toggle deep sleep between calendar checks" << std::endl;
+            std::cout << "  duty      - Show measured awake/asleep duty cycle" << std::endl;
+            std::cout << "  quit      - Exit simulator" << std::endl;
+        } else if (command == "lowpower") {
+            PowerManager::setEnabled(!PowerManager::isEnabled());
+        } else if (command == "duty") {
+            PowerManager::printReport();
         } else {
             std::cout << "Unknown command: " << command << std::endl;
         }
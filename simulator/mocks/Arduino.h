@@ -1,9 +1,13 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <cstdlib>
 #include <string>
 #include <time.h>
 #include "../simulated_time.h"
+#include <chrono>
 
 // Include FreeRTOS and ESP for ESP32 compatibility
 #ifdef SIMULATOR
@@ -41,6 +45,10 @@ public:
         return indexOf(str.c_str());
     }
 
+    String substring(size_t from, size_t to = std::string::npos) const {
+        return substr(from, to == std::string::npos ? npos : to - from);
+    }
+
     char charAt(size_t index) const {
         if (index < length()) {
             return (*this)[index];
@@ -72,10 +80,20 @@ public:
 #define PI 3.1415926535897932384626433832795
 
 // Time functions
+inline long random(long max) {
+    return max > 0 ? rand() % max : 0;
+}
+
 inline unsigned long millis() {
     return SimulatedTime::millis();
 }
 
+// Real clock, for timing host work rather than simulated waits
+inline unsigned long micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 inline void delay(unsigned long ms) {
     SimulatedTime::advance(ms);
 }
@@ -97,6 +115,37 @@ inline void pinMode(uint8_t pin, uint8_t mode) {}
 inline int digitalRead(uint8_t pin) { return LOW; }
 inline void digitalWrite(uint8_t pin, uint8_t val) {}
 
+// Interrupts (no pin ever changes in the simulator, so handlers never fire)
+#define IRAM_ATTR
+#define PROGMEM
+#define PGM_P const char*
+#define CHANGE 0x03
+#define FALLING 0x02
+#define RISING 0x01
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode) {}
+inline void detachInterrupt(uint8_t pin) {}
+
+// Byte stream interface (HTTP response bodies, serial input)
+class Stream {
+public:
+    virtual ~Stream() {}
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t write(uint8_t) { return 0; }
+
+    size_t readBytes(char* buffer, size_t length) {
+        size_t count = 0;
+        while (count < length) {
+            int c = read();
+            if (c < 0) break;
+            buffer[count++] = static_cast<char>(c);
+        }
+        return count;
+    }
+};
+
 // Forward declare IPAddress for Serial
 class IPAddress;
 
@@ -116,6 +165,7 @@ public:
     void print(unsigned long value);
     void print(double value);
     void printf(const char* format, ...);
+    void flush() {}
 
     bool available() { return false; }
     String readStringUntil(char terminator) { return ""; }
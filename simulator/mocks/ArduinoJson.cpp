@@ -48,3 +48,8 @@ template<>
 JsonArray JsonDocument::as<JsonArray>() {
     return JsonArray();
 }
+
+template<>
+JsonVariant JsonDocument::as<JsonVariant>() {
+    return JsonVariant();
+}
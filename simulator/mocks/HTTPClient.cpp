@@ -22,6 +22,12 @@ bool HTTPClient::begin(const String& url) {
     return true;
 }
 
+// Pooled connections stay "connected" after their first request, as a kept-alive socket would
+bool HTTPClient::begin(WiFiClient& pooledClient, const String& url) {
+    client = &pooledClient;
+    return begin(url);
+}
+
 void HTTPClient::addHeader(const String& name, const String& value) {
     // Store headers if needed
 }
@@ -52,10 +58,21 @@ int HTTPClient::POST(const String& payload) {
     }
 }
 
+int HTTPClient::sendRequest(const char* type, const String& payload) {
+    int result = strcmp(type, "POST") == 0 ? POST(payload) : GET();
+    if (client != nullptr && result > 0) client->markConnected();
+    return result;
+}
+
 String HTTPClient::getString() {
     return responseBody;
 }
 
+Stream& HTTPClient::getStream() {
+    bodyStream.setContent(responseBody);
+    return bodyStream;
+}
+
 void HTTPClient::end() {
     responseBody = "";
     responseCode = 0;
@@ -1,27 +1,50 @@
 #pragma once
 
 #include "Arduino.h"
+#include "WiFiClientSecure.h"
 
 #define HTTP_GET 0
 #define HTTP_POST 1
 
+// Serves a buffered mock response body through the Stream interface
+class StringStream : public Stream {
+public:
+    void setContent(const String& body) { content = body; position = 0; }
+    int available() override { return content.length() - position; }
+    int read() override { return position < content.length() ? (uint8_t)content[position++] : -1; }
+    int peek() override { return position < content.length() ? (uint8_t)content[position] : -1; }
+
+private:
+    String content;
+    size_t position = 0;
+};
+
 class HTTPClient {
 public:
     HTTPClient();
     ~HTTPClient();
 
     bool begin(const String& url);
+    bool begin(WiFiClient& client, const String& url);
+    void setReuse(bool reuse) {}
     void addHeader(const String& name, const String& value);
     int GET();
     int POST(const String& payload);
+    int sendRequest(const char* type, const String& payload);
+    int getSize() { return responseBody.length(); }
     String getString();
+    Stream& getStream();
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {}
+    String header(const char* name) { return ""; }
     void end();
 
 private:
     String currentUrl;
     String responseBody;
+    StringStream bodyStream;
     int responseCode;
     bool useMockMode;
+    WiFiClient* client = nullptr;
 
     bool loadMockResponse();
 };
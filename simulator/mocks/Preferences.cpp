@@ -93,6 +93,11 @@ bool Preferences::remove(const char* key) {
     return false;
 }
 
+bool Preferences::isKey(const char* key) {
+    if (currentNamespace.empty()) return false;
+    return storage[currentNamespace].count(key) > 0;
+}
+
 String Preferences::getString(const char* key, const String& defaultValue) {
     if (currentNamespace.empty()) return defaultValue;
 
@@ -122,3 +127,38 @@ int Preferences::getInt(const char* key, int defaultValue) {
 bool Preferences::putInt(const char* key, int value) {
     return putString(key, std::to_string(value));
 }
+
+uint32_t Preferences::getULong(const char* key, uint32_t defaultValue) {
+    String value = getString(key, "");
+    if (value.empty()) return defaultValue;
+    return std::stoul(value);
+}
+
+size_t Preferences::putULong(const char* key, uint32_t value) {
+    return putString(key, std::to_string(value)) ? sizeof(value) : 0;
+}
+
+// Blobs are stored hex-encoded to keep the state file line-based
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+    String hex = getString(key, "");
+    size_t len = hex.length() / 2;
+    if (len == 0 || len > maxLen) return 0;
+
+    uint8_t* out = static_cast<uint8_t*>(buf);
+    for (size_t i = 0; i < len; i++) {
+        out[i] = static_cast<uint8_t>(std::stoi(hex.substr(i * 2, 2), nullptr, 16));
+    }
+    return len;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+    static const char* digits = "0123456789abcdef";
+    const uint8_t* in = static_cast<const uint8_t*>(value);
+
+    std::string hex;
+    for (size_t i = 0; i < len; i++) {
+        hex += digits[in[i] >> 4];
+        hex += digits[in[i] & 0x0f];
+    }
+    return putString(key, hex) ? len : 0;
+}
@@ -10,6 +10,7 @@ public:
     void end();
     void clear();
     bool remove(const char* key);
+    bool isKey(const char* key);
 
     String getString(const char* key, const String& defaultValue = "");
     bool putString(const char* key, const String& value);
@@ -17,6 +18,12 @@ public:
     int getInt(const char* key, int defaultValue = 0);
     bool putInt(const char* key, int value);
 
+    uint32_t getULong(const char* key, uint32_t defaultValue = 0);
+    size_t putULong(const char* key, uint32_t value);
+
+    size_t getBytes(const char* key, void* buf, size_t maxLen);
+    size_t putBytes(const char* key, const void* value, size_t len);
+
 private:
     std::string currentNamespace;
     std::map<std::string, std::map<std::string, std::string>> storage;
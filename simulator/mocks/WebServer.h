@@ -5,6 +5,8 @@
 
 typedef std::function<void(void)> THandlerFunction;
 
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+
 class WebServer {
 public:
     WebServer(int port) : port(port) {}
@@ -38,8 +40,24 @@ public:
         Serial.println(content);
     }
 
+    void send_P(int code, const char* contentType, const char* content, size_t length) {
+        Serial.print("HTTP ");
+        Serial.print(code);
+        Serial.print(" ");
+        Serial.print((int)length);
+        Serial.println(" bytes");
+    }
+
     void sendHeader(const String& name, const String& value) {}
 
+    void setContentLength(size_t length) {}
+    void sendContent(const char* content, size_t length) {}
+    void sendContent(const String& content) {}
+
+    void collectHeaders(const char* headerKeys[], size_t count) {}
+    String header(const String& name) { return ""; }
+    bool hasHeader(const String& name) { return false; }
+
 private:
     int port;
 };
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Arduino.h"
+
+// Connection state only; the mock HTTPClient serves bodies itself
+class WiFiClient : public Stream {
+public:
+    virtual ~WiFiClient() {}
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    bool connected() { return isConnected; }
+    void stop() { isConnected = false; }
+    void markConnected() { isConnected = true; }
+
+private:
+    bool isConnected = false;
+};
+
+class WiFiClientSecure : public WiFiClient {
+public:
+    void setInsecure() {}
+};
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "esp_sleep.h"
+
+inline esp_err_t rtc_gpio_pullup_en(gpio_num_t gpio_num) { return ESP_OK; }
+inline esp_err_t rtc_gpio_pulldown_dis(gpio_num_t gpio_num) { return ESP_OK; }
@@ -0,0 +1,26 @@
+// ABOUTME: ESP32 sleep API mock for simulator
+// ABOUTME: Deep sleep fast-forwards simulated time instead of resetting the chip
+
+#include "esp_sleep.h"
+#include "../simulated_time.h"
+
+static uint64_t timerWakeupUs = 0;
+static esp_sleep_wakeup_cause_t wakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+    timerWakeupUs = time_in_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t gpio_num, int level) {
+    return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+    return wakeupCause;
+}
+
+void esp_deep_sleep_start() {
+    SimulatedTime::advance(timerWakeupUs / 1000);
+    wakeupCause = ESP_SLEEP_WAKEUP_TIMER;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include "esp_err.h"
+
+// RTC memory survives deep sleep on the device; the simulator never loses RAM
+#define RTC_DATA_ATTR
+
+typedef enum {
+    GPIO_NUM_0 = 0,
+    GPIO_NUM_1,
+    GPIO_NUM_2,
+} gpio_num_t;
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED = 0,
+    ESP_SLEEP_WAKEUP_EXT0 = 2,
+    ESP_SLEEP_WAKEUP_EXT1,
+    ESP_SLEEP_WAKEUP_TIMER,
+} esp_sleep_wakeup_cause_t;
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us);
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t gpio_num, int level);
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
+
+// Advances simulated time by the armed timer and returns, as if woken by it
+void esp_deep_sleep_start();
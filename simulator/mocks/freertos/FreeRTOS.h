@@ -13,6 +13,8 @@ typedef void* SemaphoreHandle_t;
 #define pdPASS 1
 #define pdFAIL 0
 #define portMAX_DELAY 0xFFFFFFFF
+#define portTICK_PERIOD_MS 1
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
 
 inline TickType_t pdMS_TO_TICKS(uint32_t ms) {
     return ms;
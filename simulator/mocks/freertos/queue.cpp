@@ -5,6 +5,7 @@
 #include <cstring>
 #include <cstdlib>
 #include <sys/time.h>
+#include "../../simulated_time.h"
 
 QueueHandle_t xQueueCreate(size_t queueLength, size_t itemSize) {
     QueueDefinition* queue = new QueueDefinition();
@@ -40,6 +41,8 @@ BaseType_t xQueueSend(QueueHandle_t handle, const void* item, TickType_t ticksTo
             gettimeofday(&tv, nullptr);
             ts.tv_sec = tv.tv_sec + (ticksToWait / 1000);
             ts.tv_nsec = (tv.tv_usec * 1000) + ((ticksToWait % 1000) * 1000000);
+            ts.tv_sec += ts.tv_nsec / 1000000000;
+            ts.tv_nsec %= 1000000000;
 
             if (pthread_cond_timedwait(&queue->notFull, &queue->mutex, &ts) != 0) {
                 pthread_mutex_unlock(&queue->mutex);
@@ -59,6 +62,27 @@ BaseType_t xQueueSend(QueueHandle_t handle, const void* item, TickType_t ticksTo
     return pdPASS;
 }
 
+// Only valid on length-1 queues: replaces whatever is waiting
+BaseType_t xQueueOverwrite(QueueHandle_t handle, const void* item) {
+    QueueDefinition* queue = static_cast<QueueDefinition*>(handle);
+
+    pthread_mutex_lock(&queue->mutex);
+
+    for (auto waiting : queue->items) {
+        delete[] waiting;
+    }
+    queue->items.clear();
+
+    uint8_t* itemCopy = new uint8_t[queue->itemSize];
+    memcpy(itemCopy, item, queue->itemSize);
+    queue->items.push_back(itemCopy);
+
+    pthread_cond_signal(&queue->notEmpty);
+    pthread_mutex_unlock(&queue->mutex);
+
+    return pdPASS;
+}
+
 BaseType_t xQueueReceive(QueueHandle_t handle, void* buffer, TickType_t ticksToWait) {
     QueueDefinition* queue = static_cast<QueueDefinition*>(handle);
 
@@ -83,9 +107,17 @@ BaseType_t xQueueReceive(QueueHandle_t handle, void* buffer, TickType_t ticksToW
             gettimeofday(&tv, nullptr);
             ts.tv_sec = tv.tv_sec + (ticksToWait / 1000);
             ts.tv_nsec = (tv.tv_usec * 1000) + ((ticksToWait % 1000) * 1000000);
+            ts.tv_sec += ts.tv_nsec / 1000000000;
+            ts.tv_nsec %= 1000000000;
 
-            if (pthread_cond_timedwait(&queue->notEmpty, &queue->mutex, &ts) != 0) {
+            int result = 0;
+            while (queue->items.empty() && result == 0) {
+                result = pthread_cond_timedwait(&queue->notEmpty, &queue->mutex, &ts);
+            }
+            if (queue->items.empty()) {
                 pthread_mutex_unlock(&queue->mutex);
+                // A timed-out wait stands in for vTaskDelay, so time moves on
+                SimulatedTime::advance(ticksToWait);
                 return pdFAIL;
             }
         }
@@ -15,5 +15,6 @@ struct QueueDefinition {
 
 QueueHandle_t xQueueCreate(size_t queueLength, size_t itemSize);
 BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait);
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item);
 BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticksToWait);
 void vQueueDelete(QueueHandle_t queue);
@@ -0,0 +1,4 @@
+#pragma once
+
+// Mutex functions live in task.h in this mock
+#include "task.h"
@@ -4,6 +4,10 @@
 #include "task.h"
 #include "../Arduino.h"
 #include <unistd.h>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 
 struct TaskParams {
     TaskFunction_t function;
@@ -73,3 +77,38 @@ void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t timeIncrement) {
 TickType_t xTaskGetTickCount() {
     return SimulatedTime::millis();
 }
+
+static std::mutex notifyMutex;
+static std::condition_variable notifyCondition;
+static std::map<pthread_t, uint32_t> notifyCounts;
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait) {
+    std::unique_lock<std::mutex> lock(notifyMutex);
+    uint32_t& count = notifyCounts[pthread_self()];
+    auto notified = [&count] { return count > 0; };
+
+    if (ticksToWait == portMAX_DELAY) {
+        notifyCondition.wait(lock, notified);
+    } else if (!notifyCondition.wait_for(lock, std::chrono::milliseconds(ticksToWait), notified)) {
+        SimulatedTime::advance(ticksToWait);
+        return 0;
+    }
+
+    uint32_t taken = count;
+    count = clearCountOnExit ? 0 : count - 1;
+    return taken;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    std::lock_guard<std::mutex> lock(notifyMutex);
+    notifyCounts[*static_cast<pthread_t*>(task)]++;
+    notifyCondition.notify_all();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken) {
+    std::lock_guard<std::mutex> lock(notifyMutex);
+    notifyCounts[*static_cast<pthread_t*>(task)]++;
+    notifyCondition.notify_all();
+    if (higherPriorityTaskWoken != nullptr) *higherPriorityTaskWoken = pdFALSE;
+}
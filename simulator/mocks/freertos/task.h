@@ -28,6 +28,11 @@ void vTaskDelay(TickType_t ticks);
 void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t timeIncrement);
 TickType_t xTaskGetTickCount();
 
+// Direct-to-task notifications, used as counting semaphores
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken);
+
 // Semaphore functions (minimal)
 inline SemaphoreHandle_t xSemaphoreCreateMutex() {
     pthread_mutex_t* mutex = new pthread_mutex_t();
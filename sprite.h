@@ -0,0 +1,31 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+
+// An 8x8 1-bpp image packed into one word: bit (row * 8 + col) is set
+// where the pixel is lit. Images with more than one colour are drawn as
+// several sprites, one per palette entry.
+struct Sprite {
+    static const int SIZE = 8;
+
+    uint64_t bits;
+
+    // Builds a sprite at compile time from eight rows of ASCII art, lighting
+    // the cells that hold `on`, so one piece of art can carry several layers
+    static constexpr Sprite fromArt(const char* const (&art)[SIZE], char on = '#') {
+        uint64_t bits = 0;
+        for (int row = 0; row < SIZE; row++) {
+            for (int col = 0; col < SIZE; col++) {
+                if (art[row][col] == on) bits |= 1ULL << (row * SIZE + col);
+            }
+        }
+        return Sprite{bits};
+    }
+
+    constexpr bool isSet(int row, int col) const {
+        return (bits >> (row * SIZE + col)) & 1;
+    }
+};
+
+#endif
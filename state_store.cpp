@@ -0,0 +1,156 @@
+#include "state_store.h"
+#include <time.h>
+#include "config_manager.h"
+#include "utils.h"
+
+const uint32_t StateStore::SETTLE_MS;
+const uint8_t StateStore::RECORD_VERSION;
+
+Preferences StateStore::preferences;
+const char* StateStore::PREF_NAMESPACE = "state";
+const char* StateStore::KEY_RECORD = "record";
+
+StateStore::Record StateStore::record = {};
+bool StateStore::loaded = false;
+bool StateStore::valid = false;
+bool StateStore::unsettled = false;
+uint32_t StateStore::unsettledSince = 0;
+time_t StateStore::unsettledCompletedTime = 0;
+uint32_t StateStore::skippedWrites = 0;
+
+void StateStore::begin() {
+    if (loaded) return;
+    loaded = true;
+
+    preferences.begin(PREF_NAMESPACE, false);
+    if (!preferences.isKey(KEY_RECORD)) {
+        record = Record();
+        valid = false;
+
+        // Firmware before the record kept the state with the other settings
+        int legacyState;
+        time_t legacyCompletedTime;
+        if (ConfigManager::getLegacyState(legacyState, legacyCompletedTime)) {
+            write(static_cast<BindicatorState>(legacyState), legacyCompletedTime);
+        }
+        return;
+    }
+
+    size_t length = preferences.getBytes(KEY_RECORD, &record, sizeof(record));
+    valid = length == sizeof(record) && record.version == RECORD_VERSION && record.crc == checksum(record);
+    if (!valid) {
+        Serial.println("Saved state record is corrupt, starting from LOADING");
+        record = Record();
+        record.version = RECORD_VERSION;
+        record.state = static_cast<uint8_t>(BindicatorState::LOADING);
+        valid = true;
+    }
+}
+
+void StateStore::load(BindicatorState& state, time_t& completedTime) {
+    begin();
+    if (valid) {
+        state = static_cast<BindicatorState>(record.state);
+        completedTime = record.completedTime;
+    } else {
+        // Nothing saved yet, so the calendar hasn't been checked
+        state = BindicatorState::LOADING;
+        completedTime = 0;
+    }
+}
+
+void StateStore::save(BindicatorState state, time_t completedTime, uint32_t nowMs) {
+    begin();
+    if (!isTransient(state)) {
+        unsettled = false;
+        write(state, completedTime);
+        return;
+    }
+
+    if (!unsettled) {
+        unsettled = true;
+        unsettledSince = nowMs;
+    }
+    unsettledCompletedTime = completedTime;
+
+    if (Utils::msRemaining(unsettledSince, SETTLE_MS, nowMs) > 0) {
+        skippedWrites++;
+        return;
+    }
+    flush();
+}
+
+void StateStore::settle(uint32_t nowMs) {
+    if (unsettled && Utils::msRemaining(unsettledSince, SETTLE_MS, nowMs) == 0) {
+        flush();
+    }
+}
+
+void StateStore::flush() {
+    if (!unsettled) return;
+
+    begin();
+    write(BindicatorState::LOADING, unsettledCompletedTime);
+    unsettled = false;
+}
+
+bool StateStore::isTransient(BindicatorState state) {
+    return state == BindicatorState::LOADING ||
+           state == BindicatorState::ERROR_API ||
+           state == BindicatorState::ERROR_WIFI;
+}
+
+void StateStore::write(BindicatorState state, time_t completedTime) {
+    if (valid && record.state == static_cast<uint8_t>(state) && record.completedTime == completedTime) {
+        skippedWrites++;
+        return;
+    }
+
+    Record updated = record;
+    updated.version = RECORD_VERSION;
+    updated.state = static_cast<uint8_t>(state);
+    updated.completedTime = completedTime;
+
+    int32_t day = today();
+    if (updated.writeDay != day) {
+        updated.writeDay = day;
+        updated.writesToday = 0;
+    }
+    updated.writesToday++;
+    updated.totalWrites++;
+    updated.crc = checksum(updated);
+
+    if (preferences.putBytes(KEY_RECORD, &updated, sizeof(updated)) != sizeof(updated)) {
+        Serial.println("Failed to save state record");
+        return;
+    }
+    record = updated;
+    valid = true;
+}
+
+void StateStore::clear() {
+    begin();
+    preferences.remove(KEY_RECORD);
+    record = Record();
+    valid = false;
+    unsettled = false;
+}
+
+uint16_t StateStore::getWritesToday() {
+    return record.writeDay == today() ? record.writesToday : 0;
+}
+
+uint32_t StateStore::checksum(const Record& record) {
+    return Utils::crc32(&record, offsetof(Record, crc));
+}
+
+int32_t StateStore::today() {
+    return static_cast<int32_t>(time(nullptr) / (24 * 60 * 60));
+}
+
+#ifdef TESTING
+void StateStore::clearForTesting() {
+    clear();
+    skippedWrites = 0;
+}
+#endif
@@ -0,0 +1,73 @@
+#ifndef STATE_STORE_H
+#define STATE_STORE_H
+
+#include <Arduino.h>
+#ifdef ESP32
+    #include <Preferences.h>
+#else
+    #include "Preferences.h"
+#endif
+#include "bindicator_state.h"
+
+// Persists the Bindicator state and completed time as one CRC-checked record,
+// written only when it would change what the device boots into. LOADING and
+// the error states all boot as LOADING, so flapping between them costs
+// nothing; they reach flash only once the device has been unsettled for
+// SETTLE_MS, so a long outage doesn't leave yesterday's bin on screen. The
+// record carries its own write counters, so tracking wear costs no writes.
+class StateStore {
+    public:
+        static const uint32_t SETTLE_MS = 10 * 60 * 1000;
+
+        static void begin();
+        static void load(BindicatorState& state, time_t& completedTime);
+        static void save(BindicatorState state, time_t completedTime, uint32_t nowMs);
+        // A steady outage never saves again, so waiting tasks call settle()
+        // to write the pending LOADING once SETTLE_MS has passed, and flush()
+        // writes it at once before a deep sleep forgets the unsettled time
+        static void settle(uint32_t nowMs);
+        static void flush();
+        static void clear();
+
+        static uint16_t getWritesToday();
+        static uint32_t getTotalWrites() { return record.totalWrites; }
+        static uint32_t getSkippedWrites() { return skippedWrites; }
+
+        #ifdef TESTING
+        static void clearForTesting();
+        #endif
+
+    private:
+        static const uint8_t RECORD_VERSION = 2;
+
+        // Laid out without padding, so the CRC covers no stray bytes
+        struct Record {
+            uint8_t version;
+            uint8_t state;
+            uint16_t writesToday;
+            int32_t writeDay;      // Days since the epoch that writesToday counts
+            int64_t completedTime; // time_t, which outgrows 32 bits in 2038
+            uint32_t totalWrites;
+            uint32_t crc;          // Over everything above
+        };
+        static_assert(sizeof(Record) == 24, "StateStore::Record has padding");
+
+        static Preferences preferences;
+        static const char* PREF_NAMESPACE;
+        static const char* KEY_RECORD;
+
+        static Record record;
+        static bool loaded;
+        static bool valid;
+        static bool unsettled;
+        static uint32_t unsettledSince;
+        static time_t unsettledCompletedTime;
+        static uint32_t skippedWrites;
+
+        static bool isTransient(BindicatorState state);
+        static void write(BindicatorState state, time_t completedTime);
+        static uint32_t checksum(const Record& record);
+        static int32_t today();
+};
+
+#endif
@@ -6,6 +6,11 @@
 #include "animations.h"
 #include "bin_type.h"
 #include "bindicator.h"
+#include "bin_schedule.h"
+#include "config_manager.h"
+#include "wake_planner.h"
+#include "power_manager.h"
+#include "state_store.h"
 #include <WiFi.h>
 
 uint8_t Matrix_Data[8][8];
@@ -18,71 +23,73 @@ const uint32_t CALENDAR_CHECK_INTERVAL_MS = 3600000;  // 1 hour
 extern CalendarHandler calendar;
 
 void animationTask(void* parameter) {
-    TickType_t xLastWakeTime = xTaskGetTickCount();
-    const TickType_t xFrequency = pdMS_TO_TICKS(30);
-
     Serial.println("Animation task started");
 
-    static bool isLoading = true;
-    static bool isSetupMode = false;
-    static bool isError = false;
-    static bool isBin = false;
-    static bool isComplete = false;
-    static Color color = Animations::DEFAULT_BLUE;
+    Scene scene = Scene::LOADING;
+    ErrorType errorType = ErrorType::API;
+    Color color = Animations::DEFAULT_BLUE;
+    TickType_t lastFrameTime = xTaskGetTickCount();
 
     extern DisplayHandler display;
 
     while(true) {
+        // Animated scenes wait out the rest of their frame interval for a
+        // command; static ones have nothing to redraw until one arrives
+        TickType_t wait = portMAX_DELAY;
+        uint32_t frameMs = Animations::frameIntervalMs(scene);
+        if (frameMs > 0) {
+            TickType_t elapsed = xTaskGetTickCount() - lastFrameTime;
+            TickType_t interval = pdMS_TO_TICKS(frameMs);
+            wait = elapsed < interval ? interval - elapsed : 0;
+        }
+
         Command cmd = CMD_NONE;
-        if (xQueueReceive(commandQueue, &cmd, 0) == pdTRUE) {
+        if (xQueueReceive(commandQueue, &cmd, wait) == pdTRUE) {
             Serial.printf("Animation received command: %d\n", cmd);
-            isLoading = false;
-            isError = false;
-            isBin = false;
-            isComplete = false;
 
             switch(cmd) {
                 case CMD_SHOW_RECYCLING:
                     Serial.println("Switching to green (recycling)");
-                    isBin = true;
+                    scene = Scene::BIN;
                     color = Animations::RECYCLING_GREEN;
                     break;
                 case CMD_SHOW_RUBBISH:
                     Serial.println("Switching to brown (rubbish)");
-                    isBin = true;
+                    scene = Scene::BIN;
                     color = Animations::RUBBISH_BROWN;
                     break;
                 case CMD_SHOW_NEITHER:
                     Serial.println("Switching to blue (neither)");
+                    scene = Scene::PULSE;
                     color = Animations::DEFAULT_BLUE;
                     break;
                 case CMD_SHOW_COMPLETED:
                     Serial.println("Showing completed animation");
-                    isComplete = true;
+                    scene = Scene::COMPLETE;
                     color = Animations::COMPLETE_GREEN;
                     break;
                 case CMD_SHOW_LOADING:
                     Serial.println("Showing loading animation");
-                    isLoading = true;
+                    scene = Scene::LOADING;
                     break;
                 case CMD_SHOW_SETUP_MODE:
                     Serial.println("Showing setup mode");
-                    isSetupMode = true;
+                    scene = Scene::SETUP_MODE;
                     break;
                 case CMD_SHOW_ERROR_API:
                     Serial.println("Showing API error");
-                    isError = true;
-                    Animations::drawError(display, ErrorType::API);
+                    scene = Scene::ERROR;
+                    errorType = ErrorType::API;
                     break;
                 case CMD_SHOW_ERROR_WIFI:
                     Serial.println("Showing WiFi error");
-                    isError = true;
-                    Animations::drawError(display, ErrorType::WIFI);
+                    scene = Scene::ERROR;
+                    errorType = ErrorType::WIFI;
                     break;
                 case CMD_SHOW_ERROR_OTHER:
                     Serial.println("Showing other error");
-                    isError = true;
-                    Animations::drawError(display, ErrorType::OTHER);
+                    scene = Scene::ERROR;
+                    errorType = ErrorType::OTHER;
                     break;
                 default:
                     Serial.printf("Unknown command: %d\n", cmd);
@@ -90,24 +97,75 @@ void animationTask(void* parameter) {
             }
         }
 
-        display.matrix.clear();
-
-        if (isError) {
-            Animations::drawError(display, ErrorType::API);
-        } else if (isLoading) {
-            Animations::drawLoading(display);
-        } else if (isSetupMode) {
-            Animations::drawSetupMode(display);
-        } else if (isBin) {
-            Animations::drawBinImage(display, color);
-        } else if (isComplete) {
-            Animations::drawComplete(display, color);
-        } else {
-            Animations::drawPulse(display, color);
+        lastFrameTime = xTaskGetTickCount();
+        display.beginLayer(DisplayHandler::LAYER_SCENE);
+
+        switch (scene) {
+            case Scene::ERROR:
+                Animations::drawError(display, errorType);
+                break;
+            case Scene::LOADING:
+                Animations::drawLoading(display);
+                break;
+            case Scene::SETUP_MODE:
+                Animations::drawSetupMode(display);
+                break;
+            case Scene::BIN:
+                Animations::drawBinImage(display, color);
+                break;
+            case Scene::COMPLETE:
+                Animations::drawComplete(display, color);
+                break;
+            case Scene::PULSE:
+            default:
+                Animations::drawPulse(display, color);
+                break;
+        }
+
+        // Bin states can still come from the cached schedule while offline
+        display.beginLayer(DisplayHandler::LAYER_OVERLAY);
+        bool showsSchedule = scene == Scene::BIN || scene == Scene::COMPLETE || scene == Scene::PULSE;
+        if (showsSchedule && WiFi.status() != WL_CONNECTED) {
+            Animations::drawOfflineIndicator(display);
+        }
+
+        display.showIfChanged();
+    }
+}
+
+// How long to sleep until what the display shows could next change
+static uint32_t planNextWake() {
+    WakePlanner::Inputs inputs = {};
+    inputs.state = Bindicator::getState();
+    inputs.errorRetryMs = Bindicator::msUntilErrorRetry();
+
+    int32_t today;
+    if (!Bindicator::isInErrorState() && BinSchedule::today(today)) {
+        inputs.now = time(nullptr);
+        if (inputs.state == BindicatorState::COMPLETED) {
+            inputs.resetAt = Bindicator::nextResetTime();
+        }
+        int days = BinSchedule::daysUntilChange(today, ConfigManager::getCalendarId());
+        if (days > 0) {
+            inputs.nextDayChange = WakePlanner::startOfDay(inputs.now, days);
         }
+    }
+
+    uint32_t sleepMs = WakePlanner::msUntilWake(inputs);
+    Serial.printf("Next calendar check in %lu s\n", (unsigned long)(sleepMs / 1000));
+    return sleepMs;
+}
 
-        display.matrix.show();
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
+// Waits for the next check, deep sleeping through it in low-power mode
+static void sleepUntilNextCheck() {
+    uint32_t sleepMs = planNextWake();
+    if (PowerManager::isEnabled()) {
+        // Let the animation task latch the final frame before the CPU stops
+        vTaskDelay(pdMS_TO_TICKS(100));
+        PowerManager::deepSleep(sleepMs);
+    } else {
+        vTaskDelay(sleepMs / portTICK_PERIOD_MS);
+        StateStore::settle(millis());
     }
 }
 
@@ -118,10 +176,11 @@ void calendarTask(void* parameter) {
     const TickType_t TIME_SYNC_RETRY_DELAY = pdMS_TO_TICKS(30000);
 
     Command cmd = CMD_SHOW_LOADING;
-    xQueueSend(commandQueue, &cmd, 0);
+    postCommand(cmd);
 
-    // Initial delay to allow system to stabilize and load state
-    vTaskDelay(pdMS_TO_TICKS(5000));
+    // Initial delay to allow system to stabilize and load state; state
+    // restored from RTC memory after a deep sleep is ready straight away
+    vTaskDelay(pdMS_TO_TICKS(PowerManager::wokeFromSleep() ? 500 : 5000));
 
     int timeSyncAttempts = 0;
     while (timeSyncAttempts < TIME_SYNC_MAX_RETRIES) {
@@ -158,11 +217,12 @@ void calendarTask(void* parameter) {
 
         if (!Bindicator::shouldCheckCalendar()) {
             Serial.println("Skipping calendar check - bin already taken out or wrong time");
-            vTaskDelay(xDelay);
+            sleepUntilNextCheck();
             continue;
         }
 
-        if (WiFi.status() == WL_CONNECTED) {
+        // A fresh cached schedule answers today's check without the network
+        if (WiFi.status() == WL_CONNECTED || calendar.hasFreshSchedule()) {
             Serial.println("Checking calendar...");
             bool hasRecycling = false;
             bool hasRubbish = false;
@@ -188,6 +248,6 @@ void calendarTask(void* parameter) {
             Bindicator::setErrorState(ErrorType::WIFI);
         }
 
-        vTaskDelay(xDelay);
+        sleepUntilNextCheck();
     }
 }
@@ -26,6 +26,13 @@ void animationTask(void* parameter);
 void wifiTask(void* parameter);
 void calendarTask(void* parameter);
 
+// A one-slot mailbox rather than a queue: the display only ever needs the
+// newest state, so each post replaces any command not yet picked up and
+// wakes animationTask straight away
 extern QueueHandle_t commandQueue;
 
+inline void postCommand(Command cmd) {
+    xQueueOverwrite(commandQueue, &cmd);
+}
+
 #endif
@@ -96,4 +96,7 @@ private:
 
 extern SerialClass Serial;
 
+inline unsigned long millis() { return 0; }
+inline long random(long max) { return max > 0 ? max / 2 : 0; }
+
 #endif
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <string>
+#include <cstring>
 #include "Arduino.h"  // For String class
 #include "bin_type.h"
 
@@ -53,10 +54,32 @@ public:
         return true;
     }
 
+    size_t getBytes(const char* key, void* buf, size_t maxLen) {
+        auto it = storage.find(key);
+        if (it == storage.end() || it->second.size() > maxLen) {
+            return 0;
+        }
+        memcpy(buf, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        storage[key] = std::string(static_cast<const char*>(value), len);
+        return len;
+    }
+
     void remove(const char* key) {
         storage.erase(key);
     }
 
+    bool isKey(const char* key) {
+        return storage.count(key) > 0;
+    }
+
+    void clear() {
+        storage.clear();
+    }
+
     // Add other methods as needed
 
 private:
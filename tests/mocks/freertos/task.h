@@ -16,4 +16,8 @@ BaseType_t xTaskCreate(TaskFunction_t pvTaskCode,
                       UBaseType_t uxPriority,
                       TaskHandle_t* pxCreatedTask);
 
+// Notifications only matter to tasks, which the tests never run
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify);
+
 #endif
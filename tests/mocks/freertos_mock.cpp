@@ -1,6 +1,10 @@
 #include "freertos_mock.h"
 #include <cstring>
+#include <cstdlib>
 #include <map>
+#include <mutex>
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 
 static std::map<QueueHandle_t, QueueData> queues;
 
@@ -25,6 +29,16 @@ BaseType_t xQueueSend(QueueHandle_t xQueue, const void* pvItemToQueue, int xTick
     return pdTRUE;
 }
 
+// Only valid on length-1 queues, which always end up holding just this item
+BaseType_t xQueueOverwrite(QueueHandle_t xQueue, const void* pvItemToQueue) {
+    auto& queue = queues[xQueue];
+    while (!queue.items.empty()) {
+        free(queue.items.front());
+        queue.items.pop();
+    }
+    return xQueueSend(xQueue, pvItemToQueue, 0);
+}
+
 BaseType_t xQueueReceive(QueueHandle_t xQueue, void* pvBuffer, int xTicksToWait) {
     auto& queue = queues[xQueue];
     if (queue.items.empty()) {
@@ -37,3 +51,34 @@ BaseType_t xQueueReceive(QueueHandle_t xQueue, void* pvBuffer, int xTicksToWait)
     queue.items.pop();
     return pdTRUE;
 }
+
+void vTaskDelay(unsigned int) {}
+
+// Tests drive the code directly rather than through background tasks
+BaseType_t xTaskCreate(TaskFunction_t pvTaskCode, const char* pcName, uint32_t usStackDepth,
+                       void* pvParameters, UBaseType_t uxPriority, TaskHandle_t* pxCreatedTask) {
+    if (pxCreatedTask != nullptr) *pxCreatedTask = nullptr;
+    return pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait) {
+    return 0;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify) {
+    return pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new std::mutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xTicksToWait) {
+    static_cast<std::mutex*>(xSemaphore)->lock();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore) {
+    static_cast<std::mutex*>(xSemaphore)->unlock();
+    return pdTRUE;
+}
@@ -2,6 +2,7 @@
 #define FREERTOS_MOCK_H
 
 #include <queue>
+#include <cstddef>
 
 typedef void* QueueHandle_t;
 typedef int BaseType_t;
@@ -19,5 +20,6 @@ QueueHandle_t xQueueCreate(int length, size_t itemSize);
 void vQueueDelete(QueueHandle_t xQueue);
 BaseType_t xQueueSend(QueueHandle_t xQueue, const void* pvItemToQueue, int xTicksToWait);
 BaseType_t xQueueReceive(QueueHandle_t xQueue, void* pvBuffer, int xTicksToWait);
+BaseType_t xQueueOverwrite(QueueHandle_t xQueue, const void* pvItemToQueue);
 
 #endif
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include "bin_schedule.h"
+
+class BinScheduleTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Serial.suppressOutput(true);
+        BinSchedule::invalidate();
+        BinSchedule::setHorizonDays(BinSchedule::DEFAULT_HORIZON_DAYS);
+        today = BinSchedule::dayNumber(2024, 3, 21);
+    }
+
+    void TearDown() override {
+        BinSchedule::invalidate();
+        Serial.suppressOutput(false);
+    }
+
+    int32_t today;
+};
+
+TEST_F(BinScheduleTest, DayNumberMatchesCivilCalendar) {
+    EXPECT_EQ(BinSchedule::dayNumber(1970, 1, 1), 0);
+    EXPECT_EQ(BinSchedule::dayNumber(2000, 3, 1), 11017);
+    EXPECT_EQ(BinSchedule::dayNumber(2024, 3, 1) - BinSchedule::dayNumber(2024, 2, 28), 2);
+    EXPECT_EQ(BinSchedule::dayNumber(2025, 1, 1) - BinSchedule::dayNumber(2024, 12, 31), 1);
+}
+
+TEST_F(BinScheduleTest, ParsesAllDayAndTimedStarts) {
+    int32_t day;
+    EXPECT_TRUE(BinSchedule::parseDate("2024-03-21", day));
+    EXPECT_EQ(day, today);
+    EXPECT_TRUE(BinSchedule::parseDate("2024-03-21T07:00:00+01:00", day));
+    EXPECT_EQ(day, today);
+
+    EXPECT_FALSE(BinSchedule::parseDate(nullptr, day));
+    EXPECT_FALSE(BinSchedule::parseDate("", day));
+    EXPECT_FALSE(BinSchedule::parseDate("2024-13-01", day));
+}
+
+TEST_F(BinScheduleTest, LooksUpStoredWindow) {
+    BinSchedule::Window window = BinSchedule::startWindow(today, "primary");
+    EXPECT_TRUE(window.add(1, today, BinSchedule::RECYCLING));
+    EXPECT_TRUE(window.add(2, today + 2, BinSchedule::RUBBISH));
+    EXPECT_TRUE(window.add(3, today + 2, BinSchedule::RECYCLING));
+    EXPECT_FALSE(window.add(4, today - 1, BinSchedule::RUBBISH));
+    EXPECT_FALSE(window.add(5, today + BinSchedule::WINDOW_DAYS, BinSchedule::RUBBISH));
+    EXPECT_TRUE(BinSchedule::store(window, ""));
+
+    EXPECT_TRUE(BinSchedule::isFresh(today, "primary"));
+    EXPECT_FALSE(BinSchedule::isFresh(today + 1, "primary"));
+
+    uint8_t bins;
+    EXPECT_TRUE(BinSchedule::lookup(today, "primary", bins));
+    EXPECT_EQ(bins, BinSchedule::RECYCLING);
+    EXPECT_TRUE(BinSchedule::lookup(today + 1, "primary", bins));
+    EXPECT_EQ(bins, 0);
+    EXPECT_TRUE(BinSchedule::lookup(today + 2, "primary", bins));
+    EXPECT_EQ(bins, BinSchedule::RECYCLING | BinSchedule::RUBBISH);
+    EXPECT_FALSE(BinSchedule::lookup(today - 1, "primary", bins));
+}
+
+TEST_F(BinScheduleTest, CalendarChangeInvalidatesCache) {
+    BinSchedule::store(BinSchedule::startWindow(today, "primary"), "");
+
+    uint8_t bins;
+    EXPECT_FALSE(BinSchedule::isFresh(today, "bins@group.calendar.google.com"));
+    EXPECT_FALSE(BinSchedule::lookup(today, "bins@group.calendar.google.com", bins));
+}
+
+TEST_F(BinScheduleTest, ExpiresAfterHorizon) {
+    BinSchedule::store(BinSchedule::startWindow(today, "primary"), "");
+    BinSchedule::setHorizonDays(3);
+
+    uint8_t bins;
+    EXPECT_TRUE(BinSchedule::lookup(today + 2, "primary", bins));
+    EXPECT_FALSE(BinSchedule::lookup(today + 3, "primary", bins));
+
+    BinSchedule::setHorizonDays(100);
+    EXPECT_EQ(BinSchedule::getHorizonDays(), BinSchedule::WINDOW_DAYS);
+}
+
+TEST_F(BinScheduleTest, EmptyCacheAnswersNothing) {
+    uint8_t bins;
+    EXPECT_FALSE(BinSchedule::isFresh(today, "primary"));
+    EXPECT_FALSE(BinSchedule::lookup(today, "primary", bins));
+}
+
+TEST_F(BinScheduleTest, RemovingEventRebuildsItsDay) {
+    BinSchedule::Window window = BinSchedule::startWindow(today, "primary");
+    window.add(1, today + 1, BinSchedule::RECYCLING);
+    window.add(2, today + 1, BinSchedule::RUBBISH);
+
+    EXPECT_TRUE(window.remove(1));
+    EXPECT_FALSE(window.remove(1));
+    EXPECT_EQ(window.bins[1], BinSchedule::RUBBISH);
+
+    // A moved event is removed then re-added on its new day
+    window.remove(2);
+    window.add(2, today + 3, BinSchedule::RUBBISH);
+    EXPECT_EQ(window.bins[1], 0);
+    EXPECT_EQ(window.bins[3], BinSchedule::RUBBISH);
+}
+
+TEST_F(BinScheduleTest, RechecksSameDayAfterRecheckInterval) {
+    EXPECT_TRUE(BinSchedule::isDueForRecheck(1711011600));
+
+    BinSchedule::Window window = BinSchedule::startWindow(today, "primary");
+    window.syncedAt = 1711011600;
+    BinSchedule::store(window, "token");
+
+    EXPECT_FALSE(BinSchedule::isDueForRecheck(1711011600 + BinSchedule::RECHECK_S - 1));
+    EXPECT_TRUE(BinSchedule::isDueForRecheck(1711011600 + BinSchedule::RECHECK_S));
+}
+
+TEST_F(BinScheduleTest, FullTableStillMarksTheDay) {
+    BinSchedule::Window window = BinSchedule::startWindow(today, "primary");
+    for (int i = 0; i < BinSchedule::MAX_EVENTS; i++) {
+        EXPECT_TRUE(window.add(i, today, BinSchedule::RECYCLING));
+    }
+    EXPECT_TRUE(window.full());
+
+    EXPECT_FALSE(window.add(100, today + 5, BinSchedule::RUBBISH));
+    EXPECT_EQ(window.bins[5], BinSchedule::RUBBISH);
+    EXPECT_EQ(window.eventCount, BinSchedule::MAX_EVENTS);
+}
+
+TEST_F(BinScheduleTest, DeltaSyncKeepsWindowAndToken) {
+    BinSchedule::store(BinSchedule::startWindow(today, "primary"), "token-1");
+    EXPECT_EQ(BinSchedule::getSyncToken(), "token-1");
+
+    BinSchedule::Window window = BinSchedule::current();
+    window.syncedDay = today + 5;
+    BinSchedule::store(window, "token-2");
+
+    EXPECT_EQ(BinSchedule::getSyncToken(), "token-2");
+    EXPECT_TRUE(BinSchedule::covers(today + 5, "primary"));
+    EXPECT_TRUE(BinSchedule::isFresh(today + 5, "primary"));
+    EXPECT_FALSE(BinSchedule::covers(today + BinSchedule::WINDOW_DAYS, "primary"));
+
+    BinSchedule::invalidate();
+    EXPECT_EQ(BinSchedule::getSyncToken(), "");
+}
+
+TEST_F(BinScheduleTest, CountsDaysUntilBinsChange) {
+    BinSchedule::Window window = BinSchedule::startWindow(today, "primary");
+    window.add(1, today + 3, BinSchedule::RUBBISH);
+    BinSchedule::store(window, "");
+
+    EXPECT_EQ(BinSchedule::daysUntilChange(today, "primary"), 3);
+    EXPECT_EQ(BinSchedule::daysUntilChange(today + 3, "primary"), 1);
+
+    // With nothing scheduled the answer is where the trusted data runs out
+    EXPECT_EQ(BinSchedule::daysUntilChange(today + 4, "primary"), 3);
+    EXPECT_EQ(BinSchedule::daysUntilChange(today, "other"), 0);
+}
@@ -2,7 +2,7 @@
 #include "bindicator.h"
 #include "tasks.h"
 #include "bin_type.h"
-#include "config_manager.h"
+#include "state_store.h"
 
 // Mock the command queue
 QueueHandle_t commandQueue;
@@ -11,11 +11,9 @@ class BindicatorTest : public ::testing::Test {
 protected:
     void SetUp() override {
         Serial.suppressOutput(true);
-        commandQueue = xQueueCreate(10, sizeof(Command));
+        commandQueue = xQueueCreate(1, sizeof(Command));
 
-        ConfigManager::begin();
-        ConfigManager::setState(static_cast<int>(BindicatorState::LOADING));
-        ConfigManager::setCompletedTime(0);
+        StateStore::clearForTesting();
 
         Bindicator::initializeFromStorage();
 
@@ -246,3 +244,43 @@ TEST_F(BindicatorTest, StateTransitions) {
     EXPECT_TRUE(xQueueReceive(commandQueue, &cmd, 0));
     EXPECT_EQ(cmd, CMD_SHOW_LOADING);
 }
+
+TEST_F(BindicatorTest, RestoreStateAfterDeepSleep) {
+    clearQueue();
+    Command cmd;
+
+    Bindicator::restoreState(BindicatorState::RUBBISH_DUE, 0);
+    EXPECT_TRUE(xQueueReceive(commandQueue, &cmd, 0));
+    EXPECT_EQ(cmd, CMD_SHOW_RUBBISH);
+    EXPECT_EQ(Bindicator::getState(), BindicatorState::RUBBISH_DUE);
+    // Restoring doesn't write back to storage
+    EXPECT_EQ(StateStore::getTotalWrites(), 0u);
+
+    // A completed bin whose reset hour passed during the sleep starts over
+    Bindicator::restoreState(BindicatorState::COMPLETED, time(nullptr) - 24 * 60 * 60);
+    EXPECT_TRUE(xQueueReceive(commandQueue, &cmd, 0));
+    EXPECT_EQ(cmd, CMD_SHOW_LOADING);
+}
+
+TEST_F(BindicatorTest, ErrorRetriesAfterDeepSleep) {
+    clearQueue();
+    Command cmd;
+
+    // The sleep waited out the retry interval, so the wake checks again
+    Bindicator::restoreState(BindicatorState::ERROR_API, 0);
+    EXPECT_TRUE(xQueueReceive(commandQueue, &cmd, 0));
+    EXPECT_EQ(cmd, CMD_SHOW_LOADING);
+    EXPECT_FALSE(Bindicator::isInErrorState());
+    EXPECT_TRUE(Bindicator::shouldCheckCalendar());
+}
+
+TEST_F(BindicatorTest, DisplayOnlySeesNewestState) {
+    Bindicator::updateFromCalendar(CollectionState::RECYCLING_DUE);
+    Bindicator::handleButtonPress();
+    Bindicator::setErrorState(ErrorType::WIFI);
+
+    Command cmd;
+    EXPECT_TRUE(xQueueReceive(commandQueue, &cmd, 0));
+    EXPECT_EQ(cmd, CMD_SHOW_ERROR_WIFI);
+    EXPECT_FALSE(xQueueReceive(commandQueue, &cmd, 0));
+}
@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "brightness_table.h"
+
+static constexpr BrightnessTable WAVE(false);
+static constexpr BrightnessTable EASED(true);
+
+// Fails to compile if the table isn't built at compile time
+static_assert(WAVE[0] == 127 && WAVE[64] == 255 && WAVE[192] == 0, "raised sine");
+
+TEST(BrightnessTableTest, MatchesFloatSine) {
+    for (int i = 0; i < BrightnessTable::SIZE; i++) {
+        double level = (std::sin(2.0 * M_PI * i / BrightnessTable::SIZE) + 1.0) / 2.0;
+        EXPECT_NEAR(WAVE[i], level * 255, 1.0) << "phase " << i;
+        EXPECT_NEAR(EASED[i], level * level * 255, 1.0) << "phase " << i;
+    }
+}
+
+TEST(BrightnessTableTest, IndexesByPhaseOfPeriod) {
+    EXPECT_EQ(EASED.at(0, 3000), EASED[0]);
+    EXPECT_EQ(EASED.at(750, 3000), EASED[64]);
+    EXPECT_EQ(EASED.at(3750, 3000), EASED[64]);
+    EXPECT_EQ(WAVE.at(39999, 40000), WAVE[255]);
+
+    EXPECT_EQ(BrightnessTable::scale(200, 255), 200);
+    EXPECT_EQ(BrightnessTable::scale(200, 0), 0);
+    EXPECT_EQ(BrightnessTable::scale(50, 128), 25);
+}
@@ -77,3 +77,81 @@ TEST_F(ConfigManagerTest, ProcessSetupFlagOrder) {
     // The flag should be cleared (we can verify this by trying to enter forced setup mode again)
     EXPECT_FALSE(ConfigManager::isInForcedSetupMode());
 }
+
+TEST_F(ConfigManagerTest, FlushWritesBatchedChangesOnce) {
+    uint32_t flushes = ConfigManager::getFlushCount();
+
+    ConfigManager::setBinType(BinType::RECYCLING);
+    ConfigManager::setBinTakenOutTime(1700000000);
+    ConfigManager::setCalendarId("bins@group.calendar.google.com");
+    EXPECT_EQ(ConfigManager::getBinType(), BinType::RECYCLING);
+    EXPECT_EQ(ConfigManager::getCalendarId(), "bins@group.calendar.google.com");
+
+    ConfigManager::flush();
+    EXPECT_EQ(ConfigManager::getFlushCount(), flushes + 1);
+
+    // Nothing dirty, so nothing to write
+    ConfigManager::flush();
+    EXPECT_EQ(ConfigManager::getFlushCount(), flushes + 1);
+}
+
+TEST_F(ConfigManagerTest, RejectsValuesTooLongToStore) {
+    EXPECT_FALSE(ConfigManager::setCalendarId(String(std::string(200, 'x').c_str())));
+    EXPECT_EQ(ConfigManager::getCalendarId(), "primary");
+}
+
+TEST_F(ConfigManagerTest, MigratesOldPerSettingKeys) {
+    Preferences& storage = ConfigManager::storageForTesting();
+    storage.putString("wifi_ssid", "old_ssid");
+    storage.putString("wifi_pass", "old_pass");
+    storage.putString("calendar_id", "bins@group.calendar.google.com");
+    storage.putInt("bin_type", static_cast<int>(BinType::RUBBISH));
+    storage.putInt("state", 3);
+    storage.putInt("completed_time", 1711000000);
+
+    ConfigManager::reloadForTesting();
+    EXPECT_EQ(ConfigManager::getWifiSSID(), "old_ssid");
+    EXPECT_EQ(ConfigManager::getCalendarId(), "bins@group.calendar.google.com");
+    EXPECT_EQ(ConfigManager::getBinType(), BinType::RUBBISH);
+
+    int state;
+    time_t completedTime;
+    EXPECT_TRUE(ConfigManager::getLegacyState(state, completedTime));
+    EXPECT_EQ(state, 3);
+    EXPECT_EQ(completedTime, 1711000000);
+
+    // One blob replaces the old keys, and reads back the same
+    ConfigManager::flush();
+    EXPECT_TRUE(storage.isKey("config"));
+    EXPECT_FALSE(storage.isKey("wifi_ssid"));
+    EXPECT_FALSE(storage.isKey("state"));
+
+    ConfigManager::reloadForTesting();
+    EXPECT_EQ(ConfigManager::getWifiPassword(), "old_pass");
+    EXPECT_EQ(ConfigManager::getBinType(), BinType::RUBBISH);
+}
+
+TEST_F(ConfigManagerTest, BinTakenOutTimeSurvives2038) {
+    const time_t takenOut = 4102444800;  // 2100-01-01
+    ConfigManager::setBinTakenOutTime(takenOut);
+    ConfigManager::flush();
+
+    ConfigManager::reloadForTesting();
+    EXPECT_EQ(ConfigManager::getBinTakenOutTime(), takenOut);
+}
+
+TEST_F(ConfigManagerTest, CorruptBlobIsDetected) {
+    ConfigManager::setWifiCredentials("test_ssid", "test_pass");
+    ConfigManager::flush();
+
+    Preferences& storage = ConfigManager::storageForTesting();
+    uint8_t blob[512];
+    size_t size = storage.getBytes("config", blob, sizeof(blob));
+    ASSERT_GT(size, 16u);
+    blob[10] ^= 0x40;
+    storage.putBytes("config", blob, size);
+
+    ConfigManager::reloadForTesting();
+    EXPECT_FALSE(ConfigManager::isConfigured());
+    EXPECT_EQ(ConfigManager::getCalendarId(), "primary");
+}
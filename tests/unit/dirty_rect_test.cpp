@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include "dirty_rect.h"
+
+TEST(DirtyRectTest, GrowsToCoverTouchedPixels) {
+    DirtyRect rect;
+    EXPECT_TRUE(rect.isEmpty());
+
+    rect.include(3, 4);
+    EXPECT_FALSE(rect.isEmpty());
+    EXPECT_EQ(rect.left, 3);
+    EXPECT_EQ(rect.right, 3);
+
+    rect.include(1, 6);
+    EXPECT_EQ(rect.left, 1);
+    EXPECT_EQ(rect.top, 4);
+    EXPECT_EQ(rect.right, 3);
+    EXPECT_EQ(rect.bottom, 6);
+
+    rect.reset();
+    EXPECT_TRUE(rect.isEmpty());
+}
+
+TEST(DirtyRectTest, UnionIgnoresEmptyRects) {
+    DirtyRect scene, overlay, region;
+    overlay.include(7, 0);
+
+    region.include(scene);
+    EXPECT_TRUE(region.isEmpty());
+
+    scene.include(3, 3);
+    scene.include(4, 4);
+    region.include(scene);
+    region.include(overlay);
+    EXPECT_EQ(region.left, 3);
+    EXPECT_EQ(region.top, 0);
+    EXPECT_EQ(region.right, 7);
+    EXPECT_EQ(region.bottom, 4);
+}
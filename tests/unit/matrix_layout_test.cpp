@@ -0,0 +1,34 @@
+#include <gtest/gtest.h>
+#include "matrix_layout.h"
+
+typedef MatrixLayout<8, 8, Rotation::NONE> Plain8x8;
+typedef MatrixLayout<8, 4, Rotation::CW_90> Tall4x8;
+typedef MatrixLayout<8, 8, Rotation::NONE, Wiring::ROWS, true> Mirrored8x8;
+
+static_assert(PixelMap<WaveshareS3Matrix>()[0] == 63, "table is built at compile time");
+
+TEST(MatrixLayoutTest, UpsideDownMatchesOldRotation) {
+    PixelMap<WaveshareS3Matrix> map;
+    for (int pixel = 0; pixel < 64; pixel++) {
+        int x = pixel % 8, y = pixel / 8;
+        EXPECT_EQ(map[pixel], (7 - y) * 8 + (7 - x));
+    }
+}
+
+TEST(MatrixLayoutTest, SerpentineReversesOddRows) {
+    EXPECT_EQ(Serpentine8x8::led(0, 0), 0);
+    EXPECT_EQ(Serpentine8x8::led(0, 1), 15);
+    EXPECT_EQ(Serpentine8x8::led(7, 1), 8);
+    EXPECT_EQ(Serpentine8x8::led(0, 2), 16);
+    EXPECT_EQ(Plain8x8::led(0, 1), 8);
+}
+
+TEST(MatrixLayoutTest, QuarterTurnSwapsDimensions) {
+    EXPECT_EQ(Tall4x8::WIDTH, 4);
+    EXPECT_EQ(Tall4x8::HEIGHT, 8);
+    // Logical top-left lands in the panel's top-right corner
+    EXPECT_EQ(Tall4x8::led(0, 0), 7);
+    EXPECT_EQ(Tall4x8::led(3, 7), 24);
+
+    EXPECT_EQ(Mirrored8x8::led(0, 0), 7);
+}
@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+#include "sprite.h"
+
+static constexpr const char* ART[Sprite::SIZE] = {
+    "#......2",
+    "........",
+    "........",
+    "...##...",
+    "...##...",
+    "........",
+    "........",
+    "2......#"
+};
+
+static constexpr Sprite LAYER = Sprite::fromArt(ART);
+static constexpr Sprite CORNERS = Sprite::fromArt(ART, '2');
+
+static_assert(LAYER.bits == (1ULL | 1ULL << 27 | 1ULL << 28 | 1ULL << 35 | 1ULL << 36 | 1ULL << 63),
+              "bit (row * 8 + col) per lit pixel");
+
+TEST(SpriteTest, PacksArtRowMajor) {
+    EXPECT_TRUE(LAYER.isSet(0, 0));
+    EXPECT_TRUE(LAYER.isSet(3, 4));
+    EXPECT_TRUE(LAYER.isSet(7, 7));
+    EXPECT_FALSE(LAYER.isSet(0, 7));
+}
+
+TEST(SpriteTest, SplitsLayersByCharacter) {
+    EXPECT_EQ(CORNERS.bits, 1ULL << 7 | 1ULL << 56);
+    EXPECT_EQ(LAYER.bits & CORNERS.bits, 0u);
+}
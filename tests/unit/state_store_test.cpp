@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "state_store.h"
+#include "time_mock.h"
+
+class StateStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Serial.suppressOutput(true);
+        StateStore::clearForTesting();
+        setMockTime(2024, 3, 21, 9, 0, 0);
+    }
+
+    void TearDown() override {
+        StateStore::clearForTesting();
+        Serial.suppressOutput(false);
+    }
+};
+
+TEST_F(StateStoreTest, SkipsUnchangedWrites) {
+    StateStore::save(BindicatorState::RECYCLING_DUE, 0, 0);
+    StateStore::save(BindicatorState::RECYCLING_DUE, 0, 1000);
+    EXPECT_EQ(StateStore::getTotalWrites(), 1u);
+    EXPECT_EQ(StateStore::getSkippedWrites(), 1u);
+
+    StateStore::save(BindicatorState::COMPLETED, 1711011600, 2000);
+    EXPECT_EQ(StateStore::getTotalWrites(), 2u);
+
+    BindicatorState state;
+    time_t completedTime;
+    StateStore::load(state, completedTime);
+    EXPECT_EQ(state, BindicatorState::COMPLETED);
+    EXPECT_EQ(completedTime, 1711011600);
+}
+
+TEST_F(StateStoreTest, KeepsCompletedTimePast2038) {
+    const time_t completed = 4102444800;  // 2100-01-01
+    StateStore::save(BindicatorState::COMPLETED, completed, 0);
+
+    BindicatorState state;
+    time_t completedTime;
+    StateStore::load(state, completedTime);
+    EXPECT_EQ(completedTime, completed);
+}
+
+TEST_F(StateStoreTest, RetryCycleFlappingIsNotWritten) {
+    StateStore::save(BindicatorState::RUBBISH_DUE, 0, 0);
+
+    uint32_t now = 1000;
+    for (int i = 0; i < 5; i++) {
+        StateStore::save(BindicatorState::LOADING, 0, now);
+        StateStore::save(BindicatorState::ERROR_API, 0, now + 100);
+        StateStore::save(BindicatorState::RUBBISH_DUE, 0, now + 200);
+        now += 60000;
+    }
+    EXPECT_EQ(StateStore::getTotalWrites(), 1u);
+}
+
+TEST_F(StateStoreTest, LongOutageSettlesAsLoading) {
+    StateStore::save(BindicatorState::RUBBISH_DUE, 0, 0);
+    StateStore::save(BindicatorState::LOADING, 0, 1000);
+    StateStore::save(BindicatorState::ERROR_WIFI, 0, 2000);
+
+    // Flapping between unsettled states past the settle time is one write
+    uint32_t settled = 1000 + StateStore::SETTLE_MS;
+    StateStore::save(BindicatorState::LOADING, 0, settled);
+    StateStore::save(BindicatorState::ERROR_WIFI, 0, settled + 300000);
+    EXPECT_EQ(StateStore::getTotalWrites(), 2u);
+
+    BindicatorState state;
+    time_t completedTime;
+    StateStore::load(state, completedTime);
+    EXPECT_EQ(state, BindicatorState::LOADING);
+}
+
+TEST_F(StateStoreTest, SteadyOutageSettlesWithoutFurtherSaves) {
+    StateStore::save(BindicatorState::RECYCLING_DUE, 0, 0);
+    StateStore::save(BindicatorState::ERROR_WIFI, 0, 1000);
+
+    StateStore::settle(1000 + StateStore::SETTLE_MS - 1);
+    EXPECT_EQ(StateStore::getTotalWrites(), 1u);
+
+    StateStore::settle(1000 + StateStore::SETTLE_MS);
+    EXPECT_EQ(StateStore::getTotalWrites(), 2u);
+
+    BindicatorState state;
+    time_t completedTime;
+    StateStore::load(state, completedTime);
+    EXPECT_EQ(state, BindicatorState::LOADING);
+
+    // Settled once; later ticks of the same outage write nothing
+    StateStore::settle(1000 + 2 * StateStore::SETTLE_MS);
+    EXPECT_EQ(StateStore::getTotalWrites(), 2u);
+}
+
+TEST_F(StateStoreTest, FlushSettlesBeforeDeepSleep) {
+    StateStore::save(BindicatorState::RUBBISH_DUE, 0, 0);
+    StateStore::save(BindicatorState::ERROR_API, 0, 1000);
+    StateStore::flush();
+
+    BindicatorState state;
+    time_t completedTime;
+    StateStore::load(state, completedTime);
+    EXPECT_EQ(state, BindicatorState::LOADING);
+}
+
+TEST_F(StateStoreTest, CountsWritesPerDay) {
+    StateStore::save(BindicatorState::RECYCLING_DUE, 0, 0);
+    StateStore::save(BindicatorState::NO_COLLECTION, 0, 0);
+    EXPECT_EQ(StateStore::getWritesToday(), 2);
+
+    setMockTime(2024, 3, 22, 9, 0, 0);
+    EXPECT_EQ(StateStore::getWritesToday(), 0);
+    StateStore::save(BindicatorState::RUBBISH_DUE, 0, 0);
+    EXPECT_EQ(StateStore::getWritesToday(), 1);
+    EXPECT_EQ(StateStore::getTotalWrites(), 3u);
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+#include "timeline.h"
+
+static const Keyframe RAMP_KEYS[] = {
+    {0, 0},
+    {1000, 200},
+    {1500, 100}
+};
+
+TEST(TimelineTest, InterpolatesBetweenKeyframes) {
+    Timeline ramp = {RAMP_KEYS, 3, 2000, Interpolation::LINEAR};
+
+    EXPECT_EQ(ramp.sample(0), 0);
+    EXPECT_EQ(ramp.sample(500), 100);
+    EXPECT_EQ(ramp.sample(1000), 200);
+    EXPECT_EQ(ramp.sample(1250), 150);
+    // Holds after the last keyframe until the cycle restarts
+    EXPECT_EQ(ramp.sample(1999), 100);
+    EXPECT_EQ(ramp.sample(2500), 100);
+}
+
+TEST(TimelineTest, StepHoldsEachValue) {
+    Timeline steps = {RAMP_KEYS, 3, 2000, Interpolation::STEP};
+
+    EXPECT_EQ(steps.sample(999), 0);
+    EXPECT_EQ(steps.sample(1000), 200);
+    EXPECT_EQ(steps.sample(1499), 200);
+    EXPECT_EQ(steps.sample(1500), 100);
+}
+
+TEST(TimelineTest, DependsOnElapsedTimeNotFrames) {
+    Timeline ramp = {RAMP_KEYS, 3, 2000, Interpolation::LINEAR};
+
+    // However often it's sampled, the same instant gives the same value
+    EXPECT_EQ(ramp.sample(750), ramp.sample(2750));
+    EXPECT_EQ(ramp.sample(750), ramp.sample(4000000750u));
+
+    Timeline empty = {nullptr, 0, 2000, Interpolation::LINEAR};
+    EXPECT_EQ(empty.sample(100), 0);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "token_cache.h"
+
+class TokenCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TokenCache::begin();
+        TokenCache::clear();
+    }
+
+    void TearDown() override {
+        TokenCache::clear();
+    }
+};
+
+TEST_F(TokenCacheTest, ValidTokenIsServedWithoutRefreshing) {
+    TokenCache::store("cached", 60000);
+
+    int refreshes = 0;
+    String token;
+    EXPECT_TRUE(TokenCache::get(token, [&]() { refreshes++; return false; }));
+    EXPECT_EQ(token, "cached");
+    EXPECT_EQ(refreshes, 0);
+}
+
+TEST_F(TokenCacheTest, ConcurrentCallersShareOneRefresh) {
+    std::atomic<int> refreshes(0);
+    std::atomic<int> served(0);
+    auto refresh = [&]() {
+        refreshes++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        TokenCache::store("fresh", 60000);
+        return true;
+    };
+
+    std::vector<std::thread> callers;
+    for (int i = 0; i < 8; i++) {
+        callers.emplace_back([&]() {
+            String token;
+            if (TokenCache::get(token, refresh) && token == "fresh") served++;
+        });
+    }
+    for (auto& caller : callers) caller.join();
+
+    EXPECT_EQ(refreshes.load(), 1);
+    EXPECT_EQ(served.load(), 8);
+}
+
+TEST_F(TokenCacheTest, WaitersDoNotRetryAFailedRefresh) {
+    std::atomic<int> refreshes(0);
+    std::atomic<int> served(0);
+    auto refresh = [&]() {
+        refreshes++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return false;
+    };
+
+    std::vector<std::thread> callers;
+    for (int i = 0; i < 4; i++) {
+        callers.emplace_back([&]() {
+            String token;
+            if (TokenCache::get(token, refresh)) served++;
+        });
+    }
+    for (auto& caller : callers) caller.join();
+
+    EXPECT_EQ(refreshes.load(), 1);
+    EXPECT_EQ(served.load(), 0);
+}
+
+TEST_F(TokenCacheTest, RefreshIsDueMarginAndJitterBeforeExpiry) {
+    EXPECT_EQ(TokenCache::msUntilRefresh(5000), 0u);
+
+    TokenCache::store("token", 600000);
+    uint32_t wait = TokenCache::msUntilRefresh(300000);
+    EXPECT_LE(wait, 300000u);
+    EXPECT_GE(wait, 240000u);
+
+    // A margin longer than the lifetime still leaves half of it
+    EXPECT_EQ(TokenCache::msUntilRefresh(900000), 300000u);
+}
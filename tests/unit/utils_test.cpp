@@ -31,3 +31,21 @@ TEST(UrlEncodeTest, HandlesUTF8Characters) {
     EXPECT_EQ(Utils::urlEncode("£"), "%C2%A3");
     EXPECT_EQ(Utils::urlEncode("€"), "%E2%82%AC");
 }
+
+TEST(MsRemainingTest, CountsDownToZero) {
+    EXPECT_EQ(Utils::msRemaining(1000, 500, 1000), 500u);
+    EXPECT_EQ(Utils::msRemaining(1000, 500, 1400), 100u);
+    EXPECT_EQ(Utils::msRemaining(1000, 500, 1500), 0u);
+    EXPECT_EQ(Utils::msRemaining(1000, 500, 90000), 0u);
+}
+
+TEST(MsRemainingTest, SurvivesMillisWraparound) {
+    const uint32_t beforeWrap = 0xFFFFFF00u;
+    EXPECT_EQ(Utils::msRemaining(beforeWrap, 0x300, 0x100), 0x100u);
+    EXPECT_EQ(Utils::msRemaining(beforeWrap, 0x300, 0x200), 0u);
+}
+
+TEST(Crc32Test, MatchesStandardCheckValue) {
+    EXPECT_EQ(Utils::crc32("123456789", 9), 0xCBF43926u);
+    EXPECT_EQ(Utils::crc32("", 0), 0u);
+}
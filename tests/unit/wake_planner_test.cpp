@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include "wake_planner.h"
+
+class WakePlannerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        setMockTime(2024, 3, 21, 20, 0, 0);
+        inputs = {};
+        inputs.now = time(nullptr);
+    }
+
+    WakePlanner::Inputs inputs;
+};
+
+TEST_F(WakePlannerTest, CompletedSleepsUntilReset) {
+    inputs.state = BindicatorState::COMPLETED;
+    inputs.resetAt = inputs.now + 2 * 3600;
+    EXPECT_EQ(WakePlanner::msUntilWake(inputs), 2u * 3600 * 1000);
+
+    inputs.resetAt = inputs.now - 10;
+    EXPECT_EQ(WakePlanner::msUntilWake(inputs), WakePlanner::MIN_SLEEP_S * 1000);
+}
+
+TEST_F(WakePlannerTest, CollectionStatesSleepUntilBinsChange) {
+    inputs.state = BindicatorState::NO_COLLECTION;
+    inputs.nextDayChange = WakePlanner::startOfDay(inputs.now, 1);
+    EXPECT_EQ(WakePlanner::msUntilWake(inputs), 4u * 3600 * 1000);
+
+    // A change days away is capped so calendar edits are still noticed
+    inputs.state = BindicatorState::RECYCLING_DUE;
+    inputs.nextDayChange = WakePlanner::startOfDay(inputs.now, 5);
+    EXPECT_EQ(WakePlanner::msUntilWake(inputs), WakePlanner::MAX_SLEEP_S * 1000);
+}
+
+TEST_F(WakePlannerTest, ErrorsWakeForRetry) {
+    inputs.state = BindicatorState::ERROR_API;
+    inputs.errorRetryMs = 120000;
+    EXPECT_EQ(WakePlanner::msUntilWake(inputs), 120000u);
+
+    inputs.errorRetryMs = 0;
+    EXPECT_EQ(WakePlanner::msUntilWake(inputs), WakePlanner::MIN_SLEEP_S * 1000);
+}
+
+TEST_F(WakePlannerTest, FallsBackWithoutClockOrSchedule) {
+    inputs.state = BindicatorState::NO_COLLECTION;
+    EXPECT_EQ(WakePlanner::msUntilWake(inputs), WakePlanner::FALLBACK_SLEEP_S * 1000);
+
+    inputs.now = 0;
+    inputs.nextDayChange = WakePlanner::startOfDay(time(nullptr), 1);
+    EXPECT_EQ(WakePlanner::msUntilWake(inputs), WakePlanner::FALLBACK_SLEEP_S * 1000);
+}
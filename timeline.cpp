@@ -0,0 +1,18 @@
+#include "timeline.h"
+
+uint8_t Timeline::sample(uint32_t elapsedMs) const {
+    if (count == 0 || periodMs == 0) return 0;
+
+    uint32_t t = elapsedMs % periodMs;
+
+    uint8_t i = 0;
+    while (i + 1 < count && keyframes[i + 1].atMs <= t) i++;
+
+    const Keyframe& from = keyframes[i];
+    if (interpolation == Interpolation::STEP || i + 1 == count) return from.value;
+
+    const Keyframe& to = keyframes[i + 1];
+    uint32_t fraction = ((t - from.atMs) << 8) / (to.atMs - from.atMs);
+    int32_t delta = static_cast<int32_t>(to.value) - from.value;
+    return from.value + (delta * static_cast<int32_t>(fraction)) / 256;
+}
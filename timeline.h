@@ -0,0 +1,29 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <stdint.h>
+
+enum class Interpolation : uint8_t {
+    STEP,    // hold each keyframe's value until the next
+    LINEAR   // ramp towards the next keyframe, in 8.8 fixed point
+};
+
+struct Keyframe {
+    uint16_t atMs;   // from the start of the cycle
+    uint8_t value;
+};
+
+// A looping animation track sampled by elapsed time rather than frame
+// count, so dropped or slowed frames don't change its speed. Keyframes are
+// sorted by time, the first at 0; after the last one the value holds until
+// the cycle restarts. The keyframes can live in flash or in a loaded blob.
+struct Timeline {
+    const Keyframe* keyframes;
+    uint8_t count;
+    uint16_t periodMs;
+    Interpolation interpolation;
+
+    uint8_t sample(uint32_t elapsedMs) const;
+};
+
+#endif
@@ -0,0 +1,94 @@
+#include "token_cache.h"
+#include "utils.h"
+
+const uint32_t TokenCache::REFRESH_JITTER_MS;
+
+String TokenCache::accessToken;
+uint32_t TokenCache::obtainedAt = 0;
+uint32_t TokenCache::lifetimeMs = 0;
+uint32_t TokenCache::jitterMs = 0;
+SemaphoreHandle_t TokenCache::tokenLock = nullptr;
+SemaphoreHandle_t TokenCache::refreshLock = nullptr;
+unsigned long TokenCache::generation = 0;
+unsigned long TokenCache::refreshCount = 0;
+
+void TokenCache::begin() {
+    if (tokenLock != nullptr) return;
+
+    tokenLock = xSemaphoreCreateMutex();
+    refreshLock = xSemaphoreCreateMutex();
+}
+
+// Returns the cached token, refreshing it first if it has expired. Callers
+// that queue behind a refresh reuse its result rather than trying again.
+bool TokenCache::get(String& token, Refresher refresh) {
+    if (peek(token)) return true;
+
+    xSemaphoreTake(tokenLock, portMAX_DELAY);
+    unsigned long seen = generation;
+    xSemaphoreGive(tokenLock);
+
+    xSemaphoreTake(refreshLock, portMAX_DELAY);
+    bool ok = peek(token);
+    if (!ok) {
+        xSemaphoreTake(tokenLock, portMAX_DELAY);
+        bool attempted = generation != seen;
+        xSemaphoreGive(tokenLock);
+
+        ok = !attempted && runRefresh(refresh) && peek(token);
+    }
+    xSemaphoreGive(refreshLock);
+    return ok;
+}
+
+bool TokenCache::peek(String& token) {
+    xSemaphoreTake(tokenLock, portMAX_DELAY);
+    bool valid = !accessToken.isEmpty() &&
+                 Utils::msRemaining(obtainedAt, lifetimeMs, millis()) > 0;
+    if (valid) token = accessToken;
+    xSemaphoreGive(tokenLock);
+    return valid;
+}
+
+// Replaces the token even if it is still valid; used for proactive refreshes
+bool TokenCache::refresh(Refresher refresh) {
+    xSemaphoreTake(refreshLock, portMAX_DELAY);
+    bool ok = runRefresh(refresh);
+    xSemaphoreGive(refreshLock);
+    return ok;
+}
+
+void TokenCache::store(const String& token, uint32_t lifetime) {
+    xSemaphoreTake(tokenLock, portMAX_DELAY);
+    accessToken = token;
+    obtainedAt = millis();
+    lifetimeMs = lifetime;
+    jitterMs = random(REFRESH_JITTER_MS);
+    xSemaphoreGive(tokenLock);
+}
+
+void TokenCache::clear() {
+    store("", 0);
+}
+
+// How long until the current token should be replaced, margin plus jitter
+// ahead of its expiry; 0 when there is no token at all
+uint32_t TokenCache::msUntilRefresh(uint32_t marginMs) {
+    xSemaphoreTake(tokenLock, portMAX_DELAY);
+    uint32_t lead = marginMs + jitterMs;
+    uint32_t refreshAfter = lifetimeMs > lead ? lifetimeMs - lead : lifetimeMs / 2;
+    uint32_t wait = accessToken.isEmpty() ? 0 : Utils::msRemaining(obtainedAt, refreshAfter, millis());
+    xSemaphoreGive(tokenLock);
+    return wait;
+}
+
+// Expects refreshLock to be held
+bool TokenCache::runRefresh(Refresher& refresh) {
+    bool ok = refresh();
+
+    xSemaphoreTake(tokenLock, portMAX_DELAY);
+    generation++;
+    refreshCount++;
+    xSemaphoreGive(tokenLock);
+    return ok;
+}
@@ -0,0 +1,47 @@
+#ifndef TOKEN_CACHE_H
+#define TOKEN_CACHE_H
+
+#include <Arduino.h>
+#include <functional>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// The one access token shared by every caller (calendar task, setup server
+// handlers, background refresh). Reads copy it under a mutex; refreshes are
+// single-flight, so concurrent callers that find it expired wait for one
+// token request instead of each sending their own.
+class TokenCache {
+    public:
+        // Fetches a new token and hands it to store(); false on failure
+        typedef std::function<bool()> Refresher;
+
+        static void begin();
+        static bool get(String& token, Refresher refresh);
+        static bool peek(String& token);
+        static bool refresh(Refresher refresh);
+        static void store(const String& token, uint32_t lifetimeMs);
+        static void clear();
+
+        static uint32_t msUntilRefresh(uint32_t marginMs);
+        static unsigned long getRefreshCount() { return refreshCount; }
+
+    private:
+        // Spreads refreshes so a fleet restarted together doesn't hit the endpoint at once
+        static const uint32_t REFRESH_JITTER_MS = 60 * 1000;
+
+        // Guarded by tokenLock
+        static String accessToken;
+        static uint32_t obtainedAt;
+        static uint32_t lifetimeMs;
+        static uint32_t jitterMs;
+        static SemaphoreHandle_t tokenLock;
+
+        // Held for the duration of a refresh; generation counts finished attempts
+        static SemaphoreHandle_t refreshLock;
+        static unsigned long generation;
+        static unsigned long refreshCount;
+
+        static bool runRefresh(Refresher& refresh);
+};
+
+#endif
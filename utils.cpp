@@ -28,3 +28,23 @@ String Utils::urlEncode(const String& str) {
     }
     return encoded;
 }
+
+// Time left until duration has passed since the millis() stamp since, 0 once it
+// has. Unsigned subtraction keeps this right across the 49-day millis() wrap.
+uint32_t Utils::msRemaining(uint32_t since, uint32_t duration, uint32_t now) {
+    uint32_t elapsed = now - since;
+    return elapsed >= duration ? 0 : duration - elapsed;
+}
+
+// Standard CRC-32 (as zlib), bit by bit since records are only a few bytes
+uint32_t Utils::crc32(const void* data, size_t length) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
@@ -6,6 +6,8 @@
 class Utils {
     public:
         static String urlEncode(const String& str);
+        static uint32_t msRemaining(uint32_t since, uint32_t duration, uint32_t now);
+        static uint32_t crc32(const void* data, size_t length);
 };
 
 #endif
@@ -0,0 +1,53 @@
+#include "wake_planner.h"
+
+const uint32_t WakePlanner::MAX_SLEEP_S;
+const uint32_t WakePlanner::FALLBACK_SLEEP_S;
+const uint32_t WakePlanner::MIN_SLEEP_S;
+
+uint32_t WakePlanner::msUntilWake(const Inputs& inputs) {
+    if (inputs.state == BindicatorState::ERROR_API || inputs.state == BindicatorState::ERROR_WIFI) {
+        uint32_t minMs = MIN_SLEEP_S * 1000;
+        return inputs.errorRetryMs > minMs ? inputs.errorRetryMs : minMs;
+    }
+
+    time_t wakeAt = 0;
+    switch (inputs.state) {
+        case BindicatorState::COMPLETED:
+            wakeAt = inputs.resetAt;
+            break;
+        case BindicatorState::NO_COLLECTION:
+        case BindicatorState::RECYCLING_DUE:
+        case BindicatorState::RUBBISH_DUE:
+            wakeAt = inputs.nextDayChange;
+            break;
+        case BindicatorState::SETUP:
+            return MAX_SLEEP_S * 1000;
+        default:
+            break;
+    }
+
+    uint32_t sleepS = FALLBACK_SLEEP_S;
+    if (inputs.now > 0 && wakeAt > 0) {
+        time_t untilWake = wakeAt - inputs.now;
+        if (untilWake < (time_t)MIN_SLEEP_S) {
+            sleepS = MIN_SLEEP_S;
+        } else if (untilWake > (time_t)MAX_SLEEP_S) {
+            sleepS = MAX_SLEEP_S;
+        } else {
+            sleepS = untilWake;
+        }
+    }
+    return sleepS * 1000;
+}
+
+// Local midnight daysAhead days from now
+time_t WakePlanner::startOfDay(time_t now, int daysAhead) {
+    struct tm day;
+    localtime_r(&now, &day);
+    day.tm_mday += daysAhead;
+    day.tm_hour = 0;
+    day.tm_min = 0;
+    day.tm_sec = 0;
+    day.tm_isdst = -1;
+    return mktime(&day);
+}
@@ -0,0 +1,31 @@
+#ifndef WAKE_PLANNER_H
+#define WAKE_PLANNER_H
+
+#include <Arduino.h>
+#include <time.h>
+#include "bindicator_state.h"
+
+// Works out how long calendarTask can sleep: until the next instant at which
+// what the display shows could change, rather than a fixed hourly poll.
+class WakePlanner {
+    public:
+        // Caps every sleep so a wake comes after BinSchedule::RECHECK_S has
+        // passed, and its delta sync picks up same-day calendar edits
+        static const uint32_t MAX_SLEEP_S = 6 * 60 * 60;
+        // Used when there's nothing better to go on (clock not set, still loading)
+        static const uint32_t FALLBACK_SLEEP_S = 60 * 60;
+        static const uint32_t MIN_SLEEP_S = 1;
+
+        struct Inputs {
+            time_t now;              // wall clock, 0 if it isn't set
+            BindicatorState state;
+            time_t resetAt;          // COMPLETED: when the reset hour comes round
+            uint32_t errorRetryMs;   // error states: until a retry is allowed
+            time_t nextDayChange;    // start of the next day with different bins, 0 if unknown
+        };
+
+        static uint32_t msUntilWake(const Inputs& inputs);
+        static time_t startOfDay(time_t now, int daysAhead);
+};
+
+#endif
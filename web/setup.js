@@ -0,0 +1,199 @@
+let currentId = 'primary';
+
+function setStatus(id, text, complete) {
+    const element = document.querySelector(id);
+    element.textContent = text;
+    element.className = complete ? 'status-complete' : 'status-incomplete';
+}
+
+function setSection(id, complete, disabled) {
+    const section = document.querySelector(id);
+    section.classList.toggle('complete', complete);
+    section.classList.toggle('incomplete', !complete);
+    section.classList.toggle('disabled', disabled);
+}
+
+// The page itself is static and cached; everything device-specific comes from here
+function showStatus(status) {
+    currentId = status.calendarId;
+    document.querySelector('#ssid').value = status.ssid;
+    if (status.ssid) {
+        document.querySelector('#password').placeholder = '(unchanged)';
+    }
+
+    const wifiDone = status.ssid !== '' && status.wifiConnected;
+    if (status.ssid === '') {
+        setStatus('#wifi-status', 'Not Configured', false);
+    } else {
+        setStatus('#wifi-status', 'Configured (' + status.ssid + ') - ' +
+                  (status.wifiConnected ? 'Connected' : 'Not Connected'), status.wifiConnected);
+    }
+    setSection('#wifi-section', wifiDone, false);
+
+    setStatus('#oauth-status', status.authorized ? 'Connected' : 'Not Connected', status.authorized);
+    setSection('#oauth-section', status.authorized, status.ssid === '');
+    document.querySelector('#oauth-waiting').style.display = status.ssid === '' ? 'block' : 'none';
+    document.querySelector('#oauth-connect').style.display = status.ssid === '' ? 'none' : 'block';
+
+    document.querySelector('#setupComplete').style.display = status.wifiConnected && status.authorized ? 'block' : 'none';
+
+    const calendarSection = document.querySelector('#calendar-section');
+    calendarSection.classList.toggle('complete', status.authorized);
+    calendarSection.classList.toggle('disabled', !status.authorized);
+    const select = document.querySelector('#calendar_id');
+    const option = document.createElement('option');
+    option.value = currentId;
+    option.text = currentId === 'primary' ? 'Main Calendar' : currentId;
+    option.selected = true;
+    select.appendChild(option);
+}
+
+function restartDevice() {
+    if (confirm('Are you sure you want to restart the device?')) {
+        fetch('/restart', { method: 'POST' })
+            .then(() => alert('Device is restarting...'))
+            .catch(err => alert('Error: ' + err));
+    }
+}
+
+function factoryReset() {
+    if (confirm('WARNING: This will erase all settings and return the device to factory defaults.\n\nAre you sure you want to continue?')) {
+        fetch('/factory-reset', { method: 'POST' })
+            .then(() => alert('Device is resetting and will restart...'))
+            .catch(err => alert('Error: ' + err));
+    }
+}
+
+function showUpcomingBins(data) {
+    const upcomingList = document.querySelector('#upcoming-bins-list');
+    upcomingList.innerHTML = '';
+    const events = data.items || [];
+    if (events.length === 0) {
+        upcomingList.innerHTML = '<li>No collections scheduled</li>';
+    } else {
+        events.forEach(event => {
+            const date = new Date(event.start.date || event.start.dateTime);
+            const day = date.toLocaleDateString('en-GB', { weekday: 'long', month: 'long', day: 'numeric' });
+            upcomingList.innerHTML += `<li>${day}: ${event.summary}</li>`;
+        });
+    }
+}
+
+function loadCalendars() {
+    return fetch('/calendars')
+        .then(response => {
+            if (!response.ok) throw new Error(`HTTP error! status: ${response.status}`);
+            return response.json();
+        })
+        .then(data => {
+            const select = document.querySelector('#calendar_id');
+            select.innerHTML = '';
+
+            const primaryOption = document.createElement('option');
+            primaryOption.value = 'primary';
+            primaryOption.text = 'Main Calendar';
+            primaryOption.selected = currentId === 'primary';
+            select.appendChild(primaryOption);
+
+            data.items.forEach(cal => {
+                if (cal.id !== 'primary') {
+                    const option = document.createElement('option');
+                    option.value = cal.id;
+                    option.text = cal.summary;
+                    option.selected = cal.id === currentId;
+                    select.appendChild(option);
+                }
+            });
+
+            const selectedCalendar = data.items.find(cal => cal.id === currentId) ||
+                {summary: currentId === 'primary' ? 'Main Calendar' : 'Unknown Calendar'};
+            const statusElement = document.querySelector('#calendar-section .status-cell');
+            statusElement.textContent = 'Status: Configured (' + selectedCalendar.summary + ')';
+
+            document.querySelector('#calendar-loading').style.display = 'none';
+            select.style.display = 'block';
+
+            // Only fetch upcoming bins after calendar list is loaded
+            document.querySelector('#upcoming-bins').style.display = 'block';
+            document.querySelector('#upcoming-bins-list').innerHTML = '<li>Loading calendar schedule...</li>';
+
+            return fetchWithRetry('/upcoming-bins');
+        })
+        .then(data => {
+            if (data) showUpcomingBins(data);
+        })
+        .catch(error => {
+            console.error('Error:', error);
+            document.querySelector('#calendar-loading').textContent = 'Error loading calendars';
+            document.querySelector('#calendar-section .status-cell').textContent = 'Status: Error loading calendar';
+            document.querySelector('#upcoming-bins-list').innerHTML = '<li>Error loading schedule</li>';
+        });
+}
+
+function updateCalendar(event) {
+    event.preventDefault();
+    const select = document.querySelector('#calendar_id');
+    const calendarId = select.value;
+    const selectedOption = select.options[select.selectedIndex];
+
+    const statusElement = document.querySelector('#calendar-section .status-cell');
+    statusElement.textContent = 'Status: Saving...';
+
+    const upcomingDiv = document.querySelector('#upcoming-bins');
+    const upcomingList = document.querySelector('#upcoming-bins-list');
+    upcomingList.innerHTML = '<li>Loading new calendar schedule...</li>';
+    upcomingDiv.style.display = 'block';
+
+    fetch('/save-calendar', {
+        method: 'POST',
+        headers: {'Content-Type': 'application/x-www-form-urlencoded'},
+        body: 'calendar_id=' + encodeURIComponent(calendarId)
+    })
+    .then(response => {
+        if (!response.ok) throw new Error('Failed to save calendar');
+        currentId = calendarId;
+        statusElement.textContent = 'Status: Configured (' + selectedOption.text + ')';
+        return fetchWithRetry('/upcoming-bins');
+    })
+    .then(showUpcomingBins)
+    .catch(error => {
+        console.error('Error:', error);
+        statusElement.textContent = 'Error saving calendar';
+        upcomingList.innerHTML = '<li>Error loading schedule</li>';
+        alert('Failed to update calendar settings');
+    });
+
+    return false;
+}
+
+async function fetchWithRetry(url, maxRetries = 3, delay = 1000) {
+    let lastError;
+    for (let i = 0; i < maxRetries; i++) {
+        try {
+            const response = await fetch(url);
+            if (!response.ok) {
+                throw new Error(`HTTP error! status: ${response.status}`);
+            }
+            return await response.json();
+        } catch (error) {
+            console.log(`Attempt ${i + 1} failed:`, error);
+            lastError = error;
+            if (i === maxRetries - 1) break;
+            // Exponential backoff
+            await new Promise(resolve => setTimeout(resolve, delay * Math.pow(2, i)));
+        }
+    }
+    throw lastError;
+}
+
+fetch('/status')
+    .then(response => response.json())
+    .then(status => {
+        showStatus(status);
+        if (status.authorized) return loadCalendars();
+        document.querySelector('#calendar-loading').textContent = 'Connect Google Calendar first';
+    })
+    .catch(error => {
+        console.error('Error:', error);
+        setStatus('#wifi-status', 'Error loading status', false);
+    });
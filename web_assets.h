@@ -0,0 +1,357 @@
+// Generated by python/build_web_assets.py from web/ - do not edit
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+    const char* path;          // nullptr for pages only sent by handlers
+    const char* contentType;
+    const char* etag;
+    const char* cacheControl;
+    const uint8_t* gzipped;
+    size_t length;
+};
+
+// setup.css: 3058 bytes minified, 892 gzipped
+static const uint8_t WEB_SETUP_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x56, 0x6d, 0x6f, 0xdb, 0x20,
+    0x10, 0xfe, 0xde, 0x5f, 0x81, 0x5a, 0x4d, 0xdd, 0xa6, 0x12, 0xd9, 0x8e, 0xd3, 0x65, 0x8e, 0x2a,
+    0xad, 0x9a, 0xb4, 0x3f, 0x51, 0xed, 0x03, 0xb6, 0xcf, 0x09, 0x2b, 0x06, 0x64, 0x70, 0x9b, 0x6c,
+    0xea, 0x7f, 0x1f, 0xf8, 0x15, 0x13, 0xa7, 0x4d, 0xb7, 0x5a, 0x6a, 0xe4, 0x33, 0x1c, 0xcf, 0x3d,
+    0xf7, 0xdc, 0x1d, 0xa9, 0xc8, 0x0f, 0xe8, 0x0f, 0x2a, 0x04, 0xd7, 0xb8, 0x20, 0x25, 0x65, 0x87,
+    0x04, 0xdd, 0x57, 0x94, 0xb0, 0x1b, 0xa4, 0x08, 0x57, 0x58, 0x41, 0x45, 0x8b, 0x0d, 0x2a, 0xc9,
+    0x1e, 0x3f, 0xd3, 0x5c, 0xef, 0x12, 0x74, 0x1b, 0x04, 0x72, 0x6f, 0x2d, 0xd5, 0x96, 0xf2, 0x04,
+    0x05, 0x88, 0xd4, 0x5a, 0x6c, 0x90, 0x24, 0x79, 0x4e, 0xf9, 0x36, 0x41, 0x51, 0xf3, 0x39, 0x25,
+    0xd9, 0xe3, 0xb6, 0x12, 0x35, 0xcf, 0x71, 0x26, 0x98, 0xa8, 0x12, 0x74, 0x15, 0x82, 0x7d, 0x36,
+    0xa8, 0x7f, 0x2f, 0x9a, 0xbf, 0x0d, 0x7a, 0xb9, 0xf8, 0x56, 0x42, 0x4e, 0x09, 0xfa, 0xe8, 0x9e,
+    0x12, 0x1b, 0x37, 0x9f, 0x0c, 0xb2, 0xb4, 0x05, 0x38, 0xb8, 0x0f, 0x1b, 0xf7, 0x2f, 0x66, 0xd7,
+    0x42, 0x81, 0xae, 0xa5, 0x41, 0x98, 0x69, 0x2a, 0xb8, 0x59, 0x93, 0x53, 0x25, 0x19, 0x31, 0x01,
+    0x14, 0x0c, 0xcc, 0x1a, 0xfb, 0x1f, 0xe7, 0xb4, 0x6a, 0xbf, 0x27, 0xf6, 0xdc, 0xba, 0xe4, 0x3d,
+    0x72, 0x9c, 0x0a, 0xad, 0x45, 0x99, 0xa0, 0x65, 0xe3, 0xd0, 0x87, 0x2f, 0xaa, 0x1c, 0x0c, 0xc8,
+    0x50, 0xee, 0x91, 0x12, 0x8c, 0xe6, 0xe8, 0x6a, 0xb9, 0x5c, 0xf6, 0x76, 0x5c, 0x91, 0x9c, 0xd6,
+    0x2a, 0x41, 0xab, 0x66, 0xab, 0x50, 0xb4, 0x3d, 0xa1, 0x02, 0x46, 0x34, 0x7d, 0x82, 0xd9, 0xf0,
+    0xa3, 0x95, 0x7d, 0xde, 0x0a, 0xf7, 0x28, 0xa8, 0x31, 0xf0, 0xd5, 0x48, 0xfb, 0x00, 0x3e, 0x1a,
+    0xd8, 0xd8, 0x85, 0x66, 0xf1, 0xfb, 0xa8, 0x6d, 0xb6, 0x34, 0x99, 0x57, 0xf4, 0x37, 0x18, 0x67,
+    0xb1, 0x9b, 0x58, 0x4b, 0x34, 0x0a, 0x3a, 0xe7, 0xd1, 0x8c, 0xf3, 0x0e, 0x8a, 0x16, 0x32, 0xb1,
+    0xeb, 0x3c, 0xf6, 0x09, 0xa3, 0x5b, 0x8e, 0xa9, 0x86, 0xd2, 0xf0, 0x94, 0x01, 0xd7, 0x50, 0x6d,
+    0xd0, 0x96, 0xc8, 0x21, 0x83, 0xaf, 0x43, 0x8b, 0x3c, 0x68, 0x4e, 0xd6, 0x35, 0x48, 0xcc, 0xeb,
+    0x32, 0x85, 0xca, 0xca, 0xe3, 0x98, 0xe8, 0x38, 0x8e, 0x07, 0x91, 0x3d, 0xef, 0x0c, 0x82, 0x0d,
+    0xea, 0xdc, 0xb7, 0x01, 0xee, 0x80, 0x6e, 0x77, 0xba, 0x7f, 0xf3, 0x32, 0x1a, 0x46, 0xd6, 0x78,
+    0x4e, 0x2c, 0xbf, 0x6a, 0xa5, 0x69, 0x71, 0x30, 0xc7, 0x9a, 0x77, 0xae, 0xc7, 0x0f, 0x0e, 0xec,
+    0x30, 0x7e, 0x3b, 0x54, 0x2f, 0xa0, 0x1e, 0x6a, 0x30, 0x81, 0xda, 0xbc, 0xb9, 0x8e, 0xa3, 0x9e,
+    0x0f, 0x46, 0x52, 0x60, 0xae, 0xf8, 0x53, 0x26, 0xb2, 0xc7, 0x23, 0xa1, 0xac, 0x5a, 0x20, 0x94,
+    0xcb, 0x5a, 0x3f, 0xe8, 0x83, 0x84, 0xbb, 0x4b, 0x0d, 0x7b, 0x7d, 0xf9, 0xf3, 0x06, 0xb9, 0x36,
+    0x49, 0x94, 0x7a, 0x36, 0x8c, 0x58, 0xbb, 0x02, 0x66, 0x54, 0x38, 0x42, 0x0a, 0x83, 0xe0, 0x83,
+    0xe5, 0x6b, 0x6f, 0x31, 0x34, 0x92, 0xec, 0xb8, 0x33, 0x26, 0xa7, 0x80, 0xd6, 0x33, 0x32, 0x0d,
+    0x4f, 0x15, 0x55, 0x93, 0x2b, 0x2f, 0x05, 0xf1, 0x89, 0xfe, 0xd1, 0x14, 0xe0, 0xfb, 0x14, 0xfe,
+    0x4f, 0xe1, 0xce, 0xb4, 0x9a, 0xb4, 0x36, 0x71, 0xf0, 0x13, 0x72, 0xfb, 0x7e, 0xff, 0x63, 0x15,
+    0xf8, 0x8a, 0x9b, 0x38, 0xf1, 0x9a, 0x0a, 0x17, 0x1c, 0xe6, 0xa3, 0xce, 0xea, 0x4a, 0x59, 0x27,
+    0x52, 0xd0, 0x56, 0x4b, 0xaf, 0x86, 0x37, 0xc2, 0x9a, 0x64, 0x68, 0x3c, 0x3a, 0x9a, 0x49, 0xc5,
+    0xba, 0x15, 0x82, 0xd7, 0x67, 0x72, 0xfa, 0xf4, 0xa0, 0xf4, 0x81, 0xc1, 0xe7, 0xbb, 0xcb, 0x89,
+    0xf8, 0x2f, 0x7f, 0xda, 0x42, 0x3c, 0xd1, 0x49, 0xdf, 0xe5, 0x66, 0x00, 0xdb, 0x01, 0xaa, 0x5a,
+    0x69, 0xdb, 0x0e, 0x73, 0x31, 0x38, 0xca, 0x44, 0x29, 0x19, 0x68, 0x18, 0x96, 0xb5, 0xfd, 0xd9,
+    0x9f, 0x31, 0xcb, 0x09, 0x9f, 0x91, 0xa3, 0xa7, 0x2e, 0x19, 0x7e, 0x55, 0x9f, 0x9a, 0x49, 0x7d,
+    0x53, 0xb6, 0xe2, 0xc0, 0x4d, 0x99, 0x8f, 0x75, 0xec, 0x30, 0xbe, 0x0a, 0x82, 0x73, 0x0a, 0xd9,
+    0x0f, 0xc1, 0x1b, 0x2a, 0x7d, 0x44, 0xd1, 0x18, 0x91, 0x33, 0xc7, 0x86, 0x7d, 0x4d, 0xef, 0x3b,
+    0xd9, 0x5d, 0xe6, 0x07, 0xc0, 0x91, 0x13, 0xe9, 0x30, 0x38, 0x74, 0xf2, 0x8b, 0x05, 0x23, 0x35,
+    0xcf, 0x76, 0xf8, 0x7f, 0xf4, 0x6c, 0x3a, 0x89, 0xc7, 0xff, 0xac, 0x9e, 0x57, 0x7e, 0xc7, 0x5a,
+    0xcf, 0x0a, 0xdc, 0x1d, 0x22, 0xd1, 0x39, 0x24, 0xfb, 0x11, 0x4c, 0xd4, 0xde, 0xf5, 0x74, 0xf7,
+    0xd8, 0x5b, 0x6b, 0x98, 0xd4, 0x87, 0xe5, 0xfc, 0xaa, 0x96, 0x86, 0x2a, 0xb3, 0x0f, 0xa7, 0xd4,
+    0xdc, 0x72, 0x18, 0x55, 0xda, 0x99, 0x70, 0xeb, 0xf5, 0x7a, 0xe2, 0x24, 0x58, 0x7c, 0x85, 0xd2,
+    0xb9, 0xf2, 0x0c, 0x74, 0x60, 0x06, 0x85, 0x3e, 0x0f, 0xf8, 0xfc, 0x89, 0x53, 0x3f, 0xed, 0x88,
+    0xef, 0xa6, 0x1c, 0xd1, 0xb5, 0xc2, 0x19, 0x30, 0x36, 0x96, 0x4c, 0xc3, 0x52, 0xbb, 0xa8, 0xdf,
+    0xe8, 0x98, 0xba, 0x04, 0xb4, 0x16, 0xaf, 0xc5, 0xda, 0x26, 0x87, 0xd3, 0x0a, 0xc8, 0xa3, 0xe9,
+    0xda, 0xf6, 0x07, 0x5b, 0xcb, 0x71, 0x05, 0x27, 0x49, 0x0a, 0x85, 0xa8, 0xa0, 0x21, 0xa3, 0x53,
+    0xde, 0xf5, 0xb5, 0x7b, 0xc7, 0x21, 0xa9, 0xf1, 0x5b, 0x5b, 0x49, 0xf4, 0x83, 0xbf, 0xc5, 0x1e,
+    0x0c, 0x2c, 0x4f, 0x86, 0x6c, 0x3f, 0x34, 0x7c, 0x6d, 0x98, 0x7b, 0x63, 0xd0, 0x0f, 0xa5, 0x29,
+    0x84, 0x05, 0xe5, 0xbd, 0x8a, 0x1d, 0x34, 0x33, 0x42, 0x2d, 0xe2, 0x78, 0xb9, 0xbc, 0x9d, 0x71,
+    0x70, 0xde, 0xf6, 0x5e, 0xe7, 0x47, 0xdb, 0x4d, 0xe3, 0x22, 0x29, 0x83, 0xdc, 0x6c, 0x13, 0x92,
+    0x64, 0x54, 0x1f, 0xac, 0x02, 0xbe, 0xcc, 0xdf, 0x69, 0x89, 0x7d, 0x36, 0x63, 0xc6, 0xfc, 0x64,
+    0x0d, 0xe5, 0xd9, 0xe5, 0x73, 0x6c, 0x0e, 0x73, 0x38, 0xda, 0x45, 0x23, 0x01, 0xee, 0xad, 0x6b,
+    0x8c, 0x76, 0x07, 0x4c, 0x62, 0xdb, 0xb1, 0xa6, 0x77, 0xa4, 0x4e, 0xa5, 0x13, 0x11, 0xbb, 0x58,
+    0x3a, 0xb6, 0xff, 0x02, 0x17, 0x13, 0xb2, 0xf0, 0xf2, 0x0b, 0x00, 0x00,
+};
+
+// setup.js: 6752 bytes minified, 1926 gzipped
+static const uint8_t WEB_SETUP_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x58, 0xdb, 0x72, 0xdb, 0x36,
+    0x10, 0x7d, 0xd7, 0x57, 0xc0, 0x93, 0x4c, 0x48, 0xd5, 0x12, 0xe3, 0xb4, 0x6f, 0x56, 0x9c, 0x4c,
+    0x6a, 0xbb, 0x89, 0x67, 0x1c, 0x27, 0x63, 0x3b, 0x93, 0x87, 0x24, 0x53, 0xc3, 0x24, 0x64, 0xa1,
+    0xa6, 0x08, 0x15, 0x00, 0x25, 0xab, 0x8e, 0xfe, 0xbd, 0xbb, 0xb8, 0x90, 0x10, 0x45, 0xc9, 0xb7,
+    0xe9, 0xf4, 0xc1, 0x63, 0x11, 0xc4, 0x2e, 0xf6, 0x72, 0xf6, 0xec, 0x82, 0x39, 0xd3, 0x24, 0x2d,
+    0xa5, 0x64, 0x85, 0x3e, 0xca, 0xc8, 0x1e, 0x89, 0x26, 0x92, 0x8f, 0xa9, 0x9c, 0x47, 0x83, 0xce,
+    0xb0, 0x2c, 0x52, 0xcd, 0x45, 0x41, 0x14, 0xd3, 0x67, 0x9a, 0xea, 0x52, 0xc5, 0x3c, 0xeb, 0x11,
+    0xcd, 0x6e, 0x74, 0x8f, 0xa4, 0x62, 0x3c, 0xc9, 0x99, 0x66, 0x5d, 0x72, 0xdb, 0x49, 0x45, 0xa1,
+    0x34, 0x61, 0x39, 0x1b, 0x83, 0x16, 0xd0, 0x91, 0x89, 0xb4, 0xc4, 0x9f, 0xc9, 0xdf, 0x25, 0x93,
+    0xf3, 0x33, 0x78, 0x91, 0x6a, 0x21, 0x41, 0xb8, 0x3b, 0xe8, 0xb8, 0x5d, 0x09, 0x6a, 0xd9, 0x17,
+    0x85, 0xb6, 0x12, 0xf8, 0x54, 0xbf, 0x4b, 0x73, 0xaa, 0xd4, 0x09, 0x1d, 0x33, 0x78, 0xe3, 0xcf,
+    0x21, 0x6f, 0x49, 0xa4, 0x8c, 0x11, 0x7d, 0xbf, 0x14, 0x91, 0xdd, 0x6a, 0x8d, 0x17, 0xd5, 0xea,
+    0xa0, 0xb3, 0x58, 0x36, 0x9d, 0x99, 0x9f, 0xc6, 0x76, 0xbf, 0xa9, 0x47, 0x32, 0xae, 0xe8, 0x65,
+    0xce, 0xb2, 0xda, 0x7e, 0x65, 0xf7, 0xdd, 0x61, 0xbf, 0xdb, 0x65, 0x6d, 0x3c, 0xe6, 0x0a, 0x3c,
+    0x11, 0x57, 0x57, 0x39, 0x8b, 0xa3, 0xca, 0x80, 0x20, 0x38, 0x9b, 0xf6, 0x07, 0x26, 0xf7, 0xc8,
+    0xd6, 0xbd, 0x44, 0xbc, 0xd1, 0x51, 0x60, 0xff, 0xb2, 0xbb, 0x23, 0x31, 0x73, 0xa9, 0xb2, 0x81,
+    0x31, 0xee, 0x05, 0xe9, 0xb5, 0xab, 0x49, 0x4a, 0x73, 0x56, 0x64, 0x54, 0x1e, 0x65, 0x83, 0xce,
+    0x1a, 0x6f, 0xa3, 0x67, 0x4a, 0xf1, 0x2c, 0xea, 0x26, 0x53, 0x9a, 0x97, 0xac, 0x16, 0xc5, 0xd5,
+    0x41, 0x87, 0x0f, 0x49, 0x1c, 0x2c, 0xe0, 0x31, 0x6b, 0xf5, 0x4c, 0xc0, 0x8d, 0x99, 0x90, 0xa8,
+    0x6b, 0x92, 0xd3, 0x94, 0x8d, 0x44, 0x9e, 0x31, 0x89, 0x58, 0x8b, 0xc1, 0xee, 0x11, 0x2d, 0xae,
+    0xc0, 0x0d, 0x93, 0x36, 0x9b, 0x88, 0x19, 0x1f, 0xf2, 0x03, 0x51, 0x34, 0xce, 0x24, 0x5b, 0x7b,
+    0x20, 0x11, 0x91, 0x17, 0x2f, 0xfc, 0x2a, 0xee, 0x03, 0x08, 0x15, 0x70, 0x0e, 0x5b, 0x35, 0x89,
+    0xec, 0x99, 0xfd, 0x68, 0x59, 0x8d, 0xdf, 0xe8, 0x19, 0x0a, 0xf5, 0xed, 0x36, 0x88, 0x62, 0x74,
+    0x22, 0x34, 0x01, 0x1d, 0x43, 0x7e, 0x55, 0x4a, 0x13, 0xd7, 0x21, 0xcd, 0x15, 0x26, 0x61, 0x01,
+    0x78, 0x56, 0x6c, 0xb3, 0x70, 0x2d, 0x48, 0xe2, 0x88, 0x6c, 0x2f, 0x59, 0xbb, 0x4d, 0xe0, 0xe8,
+    0x3e, 0x81, 0xe5, 0x4e, 0xdc, 0x66, 0x2f, 0xe2, 0xb9, 0x7a, 0x30, 0x48, 0x76, 0xa6, 0xb8, 0x95,
+    0x6e, 0xaf, 0xd5, 0x4d, 0x93, 0xee, 0x00, 0xd4, 0xde, 0x26, 0xfb, 0x08, 0x46, 0xf9, 0xe0, 0xd5,
+    0x9e, 0x84, 0x0e, 0x08, 0x5a, 0xea, 0x51, 0xed, 0x81, 0x3b, 0x01, 0x17, 0x85, 0xe4, 0xff, 0xdc,
+    0x6d, 0x55, 0x8b, 0x88, 0x3b, 0xa1, 0xb2, 0xc7, 0x1d, 0x51, 0x19, 0xb4, 0x22, 0xd0, 0x23, 0x2d,
+    0x59, 0xda, 0x00, 0x43, 0xab, 0x70, 0x46, 0xb9, 0xe6, 0xc5, 0x15, 0x60, 0x48, 0xe9, 0x79, 0xce,
+    0x12, 0xc0, 0x3f, 0x80, 0x69, 0xde, 0xc0, 0x88, 0xd5, 0x86, 0x5e, 0x5c, 0xe6, 0x22, 0xbd, 0x36,
+    0x1e, 0x14, 0x10, 0x8d, 0xe8, 0x4e, 0xfd, 0xa9, 0xf5, 0xf1, 0xde, 0xfa, 0x8d, 0x56, 0x54, 0x6f,
+    0x0f, 0xda, 0x54, 0x46, 0x4c, 0x97, 0x93, 0x7d, 0x5f, 0xea, 0x6b, 0xf5, 0x2f, 0xa3, 0xa3, 0x46,
+    0xf9, 0x72, 0x72, 0x56, 0xdc, 0xb2, 0x25, 0xe3, 0xeb, 0xf9, 0xec, 0x2e, 0x0e, 0x8b, 0x9e, 0xf9,
+    0xad, 0x55, 0x8a, 0x20, 0xf6, 0x0d, 0xf1, 0xcd, 0xe4, 0xd6, 0x86, 0x80, 0xbb, 0x15, 0x04, 0xd4,
+    0xb5, 0xd5, 0xaa, 0xc1, 0x71, 0x30, 0xda, 0x79, 0x1f, 0xf3, 0xff, 0x44, 0x6e, 0xf2, 0x62, 0x62,
+    0xd2, 0xf4, 0x3a, 0x95, 0x8c, 0x6a, 0x76, 0x68, 0x1b, 0x4a, 0x1c, 0xd9, 0x0d, 0x28, 0x60, 0x7f,
+    0x55, 0xa4, 0x56, 0x71, 0x63, 0xf5, 0x06, 0x5b, 0x51, 0xf8, 0xc2, 0xe6, 0xdc, 0x77, 0x45, 0xcc,
+    0xc1, 0x47, 0xca, 0x0b, 0xb2, 0xef, 0xec, 0xc0, 0x5c, 0xac, 0x2a, 0xb1, 0x7e, 0x30, 0x64, 0x5c,
+    0x2d, 0x4b, 0x86, 0x25, 0x82, 0x0b, 0x09, 0x9d, 0x4c, 0x40, 0x6a, 0x7f, 0xc4, 0xf3, 0x2c, 0xb6,
+    0x5b, 0x97, 0xf9, 0x5b, 0x32, 0x88, 0x8d, 0xd4, 0x07, 0x6c, 0xca, 0x53, 0x16, 0x23, 0x77, 0x21,
+    0xab, 0xa5, 0xc8, 0x33, 0x72, 0x1c, 0x47, 0xef, 0x24, 0x23, 0x73, 0x51, 0x12, 0x55, 0xba, 0x1f,
+    0x33, 0x0a, 0xed, 0x53, 0x0b, 0x2f, 0x47, 0xf4, 0x88, 0x91, 0xcc, 0x08, 0xbf, 0x8d, 0xba, 0x28,
+    0x3e, 0x64, 0x3a, 0x1d, 0xc5, 0xd1, 0x4b, 0xb7, 0x01, 0xa2, 0x7f, 0x4b, 0xc6, 0x0c, 0xe2, 0x9e,
+    0x01, 0x84, 0x3e, 0x7f, 0x3a, 0x3b, 0x8f, 0xc8, 0xa2, 0xdb, 0x49, 0x40, 0xae, 0x88, 0xe1, 0xbc,
+    0xbd, 0x37, 0x04, 0xfc, 0x92, 0x10, 0x31, 0x6b, 0x02, 0xe1, 0xca, 0xeb, 0x86, 0xe2, 0x4b, 0x92,
+    0x04, 0xb4, 0x76, 0xa0, 0x7b, 0xa0, 0x52, 0x26, 0x65, 0xb0, 0xff, 0x50, 0x4a, 0x21, 0x77, 0x91,
+    0xef, 0x08, 0xbc, 0xe8, 0x1a, 0xb7, 0x02, 0xc7, 0x86, 0x14, 0xf3, 0x37, 0x3f, 0x65, 0x50, 0x0d,
+    0xab, 0x7e, 0x7d, 0x7d, 0x77, 0x7a, 0x72, 0x74, 0xf2, 0x7e, 0x97, 0x9c, 0x8f, 0xe0, 0xc0, 0x19,
+    0xcf, 0x73, 0x50, 0x42, 0x81, 0x7e, 0x29, 0xfc, 0x02, 0x09, 0x3c, 0x5c, 0x11, 0x5a, 0x64, 0x60,
+    0x8c, 0x2e, 0x65, 0x11, 0xf8, 0x89, 0xde, 0x3b, 0xe5, 0xb0, 0x32, 0xa4, 0x65, 0xae, 0x55, 0xf2,
+    0xbd, 0xf8, 0x5e, 0xac, 0x8d, 0x15, 0x9c, 0x0a, 0xfa, 0xca, 0x66, 0x84, 0x9c, 0x92, 0xbe, 0x44,
+    0x13, 0x1f, 0x19, 0x27, 0x6b, 0xa9, 0x31, 0xd4, 0x38, 0xe1, 0x42, 0xf7, 0x84, 0xb8, 0x61, 0x43,
+    0xff, 0x32, 0x81, 0xea, 0x03, 0xbd, 0xbf, 0xf3, 0x42, 0xc5, 0x19, 0xd5, 0xb4, 0x9e, 0x59, 0x4a,
+    0xf7, 0x0a, 0x4b, 0x6d, 0x53, 0xd5, 0xf8, 0x7d, 0xfd, 0x4b, 0xd0, 0xd1, 0xcf, 0x61, 0x37, 0xd6,
+    0x42, 0x28, 0x9d, 0x70, 0xa0, 0x1e, 0xf9, 0xe1, 0xfc, 0xe3, 0x31, 0x36, 0xe6, 0x8a, 0x58, 0xd8,
+    0x14, 0xd4, 0x29, 0x54, 0x0d, 0xe7, 0x26, 0x5c, 0xb3, 0xb1, 0x22, 0x3f, 0x7f, 0x92, 0x6f, 0x3f,
+    0x6c, 0xbf, 0xb5, 0xaf, 0x13, 0x28, 0x85, 0x2b, 0x3d, 0x32, 0x95, 0xb2, 0x83, 0xc6, 0xad, 0x57,
+    0xfc, 0x3a, 0xe7, 0x6f, 0x4e, 0x30, 0x07, 0x79, 0x6e, 0xa9, 0x42, 0x11, 0x95, 0x8e, 0x58, 0x56,
+    0x02, 0x35, 0xbc, 0x7e, 0x09, 0x2f, 0xa3, 0xa0, 0xf5, 0x3a, 0xed, 0x43, 0x21, 0x0f, 0x29, 0x06,
+    0x6e, 0x6a, 0x86, 0xc5, 0x37, 0x95, 0xf7, 0x60, 0x13, 0xd6, 0x70, 0xc1, 0x66, 0xe4, 0x00, 0x7e,
+    0xda, 0x0d, 0x89, 0x0d, 0xb9, 0x79, 0x07, 0x96, 0x36, 0xd7, 0xce, 0xf9, 0x98, 0x55, 0xbc, 0x91,
+    0x19, 0x02, 0xc6, 0x65, 0xe0, 0xa9, 0x63, 0x81, 0xdc, 0x82, 0x8a, 0xce, 0xb4, 0x04, 0xe3, 0xe3,
+    0x88, 0x15, 0xfd, 0xf7, 0xbf, 0x1b, 0x28, 0xcc, 0x18, 0xbb, 0x86, 0xcd, 0x90, 0xa7, 0x5c, 0x40,
+    0x13, 0xea, 0x91, 0x31, 0x80, 0x68, 0x54, 0x3f, 0xda, 0x77, 0x05, 0x04, 0x5f, 0xf2, 0x14, 0xa1,
+    0xb2, 0x36, 0xb8, 0xdb, 0x7b, 0xe4, 0x02, 0x83, 0xf0, 0xfc, 0x16, 0x64, 0x16, 0xbb, 0xe4, 0xf9,
+    0xad, 0xb3, 0xb0, 0x1c, 0x23, 0xc1, 0x2c, 0x4c, 0x10, 0x2e, 0x20, 0x08, 0x4d, 0x24, 0xe4, 0x82,
+    0x66, 0x9e, 0x74, 0x94, 0x29, 0x21, 0x57, 0x0b, 0x1e, 0xc0, 0x9e, 0x19, 0x55, 0xe4, 0x81, 0x0a,
+    0xf0, 0x9b, 0x80, 0x9f, 0xcc, 0xc6, 0x0c, 0xf3, 0xb5, 0xe5, 0x97, 0x12, 0x71, 0xdd, 0x85, 0x2a,
+    0x92, 0x62, 0x66, 0xc2, 0x67, 0x50, 0x18, 0x5f, 0x7c, 0x38, 0x3f, 0xff, 0x8c, 0x30, 0x14, 0x72,
+    0xcb, 0xd1, 0x3c, 0x1a, 0x58, 0xc9, 0xd8, 0xa5, 0xc5, 0x05, 0x98, 0xe6, 0xce, 0xae, 0x5e, 0xfd,
+    0xa5, 0xa0, 0xf9, 0xa3, 0xc9, 0xfe, 0x6c, 0xc4, 0x4b, 0x98, 0xab, 0x07, 0x33, 0xbb, 0x63, 0xcc,
+    0x76, 0x58, 0x3a, 0x3a, 0xfe, 0x74, 0x7f, 0xde, 0x5f, 0x92, 0xa8, 0xe8, 0x3f, 0xb8, 0xed, 0x2c,
+    0x6f, 0x70, 0x5d, 0xa0, 0xc1, 0xf5, 0xcd, 0x5d, 0x01, 0xcd, 0xaf, 0xe9, 0x17, 0xad, 0xcc, 0xbf,
+    0xa4, 0x04, 0x47, 0x9f, 0xaa, 0xb6, 0x2a, 0xac, 0x43, 0x30, 0xea, 0xac, 0xc1, 0x43, 0xe2, 0x07,
+    0x60, 0xaf, 0xb8, 0xe6, 0x80, 0x27, 0x34, 0x3f, 0xa3, 0x77, 0xa5, 0xf3, 0xc1, 0xaa, 0x43, 0x63,
+    0x5b, 0x3f, 0x73, 0xc6, 0xa0, 0x97, 0x41, 0xdf, 0xdb, 0xdc, 0xdf, 0x16, 0x8d, 0x06, 0xcf, 0x2a,
+    0x24, 0x2f, 0x31, 0x4b, 0x32, 0xe4, 0x45, 0xe6, 0x5d, 0x6f, 0x3b, 0xa7, 0x0b, 0x15, 0xdd, 0xb9,
+    0x75, 0xc6, 0xed, 0x3e, 0xa8, 0x47, 0x47, 0x5f, 0x8a, 0xeb, 0x42, 0xcc, 0x82, 0xc5, 0x45, 0x65,
+    0x93, 0x81, 0xf5, 0xe1, 0x5d, 0xd7, 0xd7, 0xd5, 0xd1, 0x89, 0x24, 0xfe, 0x46, 0xca, 0xf2, 0xdc,
+    0x60, 0x36, 0xd4, 0xd4, 0xb8, 0xe2, 0x46, 0x67, 0xae, 0xa0, 0x56, 0x6e, 0x0d, 0x8d, 0x90, 0xf8,
+    0xe0, 0x9b, 0x2b, 0xc4, 0xa6, 0xc1, 0xb2, 0x32, 0x07, 0xa9, 0xa1, 0x7d, 0x36, 0xf6, 0x53, 0xa2,
+    0x4b, 0xcf, 0xca, 0xeb, 0x3b, 0x87, 0xd7, 0xa5, 0xc6, 0xd1, 0x76, 0xc0, 0xc3, 0x34, 0xb8, 0xd6,
+    0xb3, 0xda, 0x13, 0x8e, 0xad, 0x0b, 0xd5, 0x20, 0x5b, 0x75, 0x05, 0xe8, 0x9d, 0xbe, 0x2f, 0x84,
+    0x7c, 0xf7, 0x95, 0xeb, 0xd1, 0x29, 0xd3, 0x72, 0x0e, 0xc4, 0xd7, 0xb0, 0xb1, 0x95, 0x84, 0xb0,
+    0x8c, 0x6c, 0xeb, 0x6c, 0xef, 0xa8, 0x56, 0xa8, 0x6a, 0xd0, 0x42, 0xd6, 0xdc, 0x25, 0xc0, 0x08,
+    0xb3, 0xe4, 0x9b, 0x35, 0xf0, 0xbd, 0x79, 0xee, 0x3e, 0x2c, 0x37, 0x0d, 0x38, 0x18, 0x5d, 0x24,
+    0x6f, 0xf8, 0xad, 0xee, 0x95, 0xf0, 0x76, 0xfc, 0xad, 0x03, 0x5c, 0xfb, 0x49, 0x4f, 0xcf, 0xd9,
+    0xb2, 0x5e, 0x9f, 0xb0, 0xaa, 0x8b, 0x2f, 0x4f, 0xb6, 0xe5, 0x04, 0xdb, 0xac, 0xc7, 0xb8, 0x6d,
+    0xd5, 0x5d, 0xdf, 0xe3, 0x93, 0x89, 0x34, 0xff, 0x0f, 0xec, 0x00, 0x17, 0x3f, 0xf5, 0x3e, 0x50,
+    0x7f, 0xde, 0xc0, 0xfb, 0x95, 0xc5, 0xbe, 0x21, 0xbd, 0x26, 0x0d, 0x55, 0x0d, 0xc4, 0x6d, 0xb2,
+    0x9c, 0xa5, 0xbe, 0xf9, 0x7a, 0x71, 0xdb, 0x8e, 0x8a, 0x8c, 0xdd, 0xfc, 0xf8, 0x9f, 0xf8, 0xe2,
+    0x8c, 0x4e, 0xdd, 0xec, 0x3d, 0x68, 0x4c, 0x7d, 0x07, 0x7c, 0x7a, 0xef, 0xa1, 0xaf, 0x0e, 0xce,
+    0x7f, 0x35, 0x33, 0x86, 0x65, 0x8c, 0x33, 0xc5, 0xa6, 0x52, 0x0e, 0x3c, 0x58, 0x4f, 0x29, 0x7e,
+    0xb0, 0x51, 0x74, 0xca, 0xfa, 0x15, 0x6c, 0x61, 0x1c, 0xeb, 0x2c, 0x4f, 0xe6, 0xbd, 0xce, 0x88,
+    0xd1, 0x8c, 0x49, 0x88, 0xd5, 0x6d, 0xe4, 0x02, 0xd8, 0x3f, 0x9f, 0x4f, 0x58, 0x04, 0x3b, 0xa0,
+    0x23, 0xe5, 0x1c, 0xea, 0x1a, 0xc2, 0xff, 0xf2, 0xa6, 0x3f, 0x9b, 0xcd, 0xfa, 0xd0, 0x62, 0xc7,
+    0xfd, 0x52, 0x82, 0xba, 0x54, 0x64, 0x70, 0x21, 0x5d, 0xf4, 0x3a, 0x97, 0x22, 0xc3, 0xf9, 0x2d,
+    0xc0, 0xd2, 0x9e, 0x19, 0xc8, 0xcd, 0x8e, 0x2f, 0xa7, 0x47, 0x78, 0x7b, 0x07, 0x22, 0x85, 0x66,
+    0x5a, 0x23, 0xab, 0x5b, 0xd3, 0xcc, 0x43, 0xe7, 0xac, 0xe8, 0x0f, 0xca, 0x61, 0xde, 0xc5, 0xcb,
+    0x08, 0xfa, 0x56, 0x97, 0x24, 0xe6, 0x28, 0xf8, 0x58, 0x17, 0x7e, 0xa5, 0x7b, 0x52, 0x6b, 0x09,
+    0x87, 0x1a, 0xd7, 0x55, 0x1e, 0x4e, 0xa6, 0x4d, 0xe2, 0x7c, 0x0c, 0x5f, 0x6e, 0xf4, 0xc2, 0xf2,
+    0x89, 0x32, 0x70, 0x0f, 0x69, 0x6a, 0x33, 0xe4, 0x36, 0xb3, 0x90, 0xbb, 0x65, 0xd5, 0x01, 0xb7,
+    0x3c, 0x14, 0x80, 0xd3, 0xdd, 0x2e, 0xad, 0xab, 0x75, 0x5c, 0xf0, 0xe3, 0x19, 0x12, 0x18, 0x55,
+    0xf3, 0x22, 0x25, 0xf5, 0x3d, 0x76, 0x39, 0x5e, 0x00, 0x23, 0xb8, 0x0b, 0xd0, 0x1b, 0x7c, 0xe2,
+    0x0c, 0xef, 0x49, 0xbf, 0xc1, 0x65, 0x80, 0x59, 0x20, 0xbf, 0xda, 0xd9, 0x31, 0xb7, 0xa1, 0x9c,
+    0x69, 0x92, 0x53, 0xa5, 0x8d, 0xa5, 0x00, 0x6b, 0x30, 0x37, 0xc6, 0x35, 0x0e, 0x7b, 0x76, 0x06,
+    0xf0, 0xef, 0x75, 0xa0, 0x02, 0x9e, 0xb7, 0xb7, 0x51, 0x0a, 0xd4, 0x57, 0x23, 0x5e, 0x0d, 0x30,
+    0x42, 0xf1, 0x43, 0x98, 0x9b, 0xf9, 0xe1, 0xf4, 0xee, 0xa0, 0x05, 0x6f, 0x20, 0xfc, 0xf8, 0xc9,
+    0x7e, 0xe1, 0x43, 0x60, 0x4f, 0x5a, 0x9d, 0xf0, 0x89, 0xc9, 0x3a, 0xb1, 0x69, 0xef, 0x06, 0x49,
+    0xcf, 0xc5, 0x55, 0x7c, 0xf1, 0x4e, 0xc3, 0x24, 0x37, 0xd1, 0xa0, 0x9c, 0x03, 0xd4, 0x5e, 0x2d,
+    0x20, 0x92, 0x18, 0xfa, 0xdd, 0x8b, 0x1a, 0x04, 0x55, 0x2c, 0xc0, 0x1d, 0x66, 0x63, 0x82, 0x3e,
+    0x70, 0x33, 0xc5, 0x05, 0xc1, 0xec, 0x93, 0x57, 0x5d, 0x72, 0x09, 0xb3, 0xec, 0x35, 0xe4, 0xd1,
+    0x18, 0x83, 0x0e, 0x7d, 0x96, 0x00, 0x06, 0xc5, 0xb0, 0xe8, 0x44, 0x3e, 0x35, 0x35, 0x07, 0x39,
+    0xc4, 0x6b, 0x9d, 0x28, 0xb5, 0x5f, 0xf5, 0x49, 0xf8, 0x85, 0x7c, 0xa4, 0x7a, 0x94, 0x4c, 0xc4,
+    0x2c, 0xfe, 0xb5, 0x47, 0x78, 0xd7, 0xdf, 0xaf, 0x6d, 0x7c, 0x82, 0xa4, 0x2c, 0x6a, 0xb6, 0xb1,
+    0x1f, 0x47, 0xdb, 0x6a, 0xbb, 0x11, 0x8b, 0xaa, 0x30, 0x8c, 0x84, 0x2d, 0x80, 0xd5, 0x0f, 0xf0,
+    0x4b, 0x1f, 0xa6, 0x83, 0x4f, 0x5e, 0xfe, 0x53, 0x46, 0xe3, 0x5e, 0xf7, 0xa4, 0x99, 0xc2, 0x7d,
+    0x3f, 0x24, 0xef, 0x85, 0xb8, 0xca, 0x59, 0x35, 0xea, 0x92, 0x21, 0x97, 0xc0, 0xde, 0x8f, 0x9c,
+    0x71, 0x36, 0x7c, 0x00, 0x6f, 0xd4, 0x9e, 0x5f, 0xaf, 0xbe, 0xa1, 0xc3, 0xdf, 0xbf, 0xd4, 0xcc,
+    0xba, 0x13, 0x60, 0x1a, 0x00, 0x00,
+};
+
+// index.html: 3064 bytes minified, 1131 gzipped
+static const uint8_t WEB_INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x56, 0x6d, 0x6f, 0xdb, 0x36,
+    0x10, 0xfe, 0x9e, 0x5f, 0xc1, 0xaa, 0x5f, 0x3a, 0xa0, 0xb2, 0xe3, 0xc4, 0x5e, 0xba, 0x44, 0xd6,
+    0x80, 0xb9, 0x6b, 0x31, 0x60, 0x68, 0x83, 0xa6, 0xc3, 0xd0, 0x4f, 0x05, 0x4d, 0x9e, 0x2d, 0x2e,
+    0x94, 0x48, 0x90, 0x94, 0x1d, 0xff, 0xfb, 0x1d, 0x5f, 0x24, 0x5b, 0x76, 0x92, 0x76, 0x2f, 0xc9,
+    0x07, 0x83, 0xe4, 0xdd, 0xf1, 0xb9, 0x7b, 0x9e, 0x3b, 0xaa, 0x78, 0xf1, 0xf6, 0xe3, 0xe2, 0xf3,
+    0x97, 0xdb, 0x5f, 0x49, 0xe5, 0x6a, 0x59, 0x9e, 0x15, 0xdd, 0x0f, 0x50, 0x8e, 0x3f, 0x35, 0x38,
+    0x4a, 0x1a, 0x5a, 0xc3, 0x3c, 0xdb, 0x08, 0xd8, 0x6a, 0x65, 0x5c, 0x46, 0x98, 0x6a, 0x1c, 0x34,
+    0x6e, 0x9e, 0x6d, 0x05, 0x77, 0xd5, 0x9c, 0xc3, 0x46, 0x30, 0xc8, 0xc3, 0xe2, 0x35, 0x11, 0x8d,
+    0x70, 0x82, 0xca, 0xdc, 0x32, 0x2a, 0x61, 0x3e, 0x19, 0x9d, 0x67, 0x18, 0xc6, 0x09, 0x27, 0xa1,
+    0xfc, 0x45, 0x34, 0x5c, 0x30, 0xea, 0x94, 0x21, 0x77, 0xe0, 0x5a, 0x5d, 0x8c, 0xe3, 0xfe, 0x59,
+    0x21, 0x45, 0x73, 0x4f, 0x0c, 0xc8, 0x79, 0x66, 0xdd, 0x4e, 0x82, 0xad, 0x00, 0xf0, 0x9e, 0xca,
+    0xc0, 0x6a, 0x9e, 0x8d, 0xad, 0xb7, 0x1d, 0x31, 0x6b, 0x7f, 0xde, 0xcc, 0x57, 0x57, 0xec, 0x6a,
+    0x72, 0xc1, 0xf8, 0x9b, 0x2b, 0x46, 0x2f, 0x67, 0xd3, 0x9f, 0x7c, 0xf0, 0x71, 0xc2, 0xba, 0x54,
+    0x7c, 0xe7, 0x91, 0x4f, 0x1e, 0xb9, 0x08, 0x37, 0xcf, 0x0a, 0x2e, 0x36, 0x44, 0x70, 0x0f, 0x7b,
+    0x25, 0x72, 0x0b, 0xcc, 0x09, 0xd5, 0x60, 0x36, 0x92, 0x5a, 0x8b, 0x17, 0x7b, 0xc3, 0x6e, 0x17,
+    0xb3, 0x60, 0xaa, 0xd6, 0x12, 0x1c, 0x64, 0xc9, 0xb1, 0x37, 0x0b, 0x06, 0x79, 0xaa, 0x81, 0x3f,
+    0xad, 0x2e, 0xca, 0xc2, 0x6a, 0xda, 0xf4, 0x26, 0x0e, 0x74, 0xde, 0xb4, 0xf5, 0x12, 0x4c, 0x56,
+    0x4e, 0x8a, 0xb1, 0x3f, 0x2b, 0xc9, 0x9f, 0xe2, 0x9d, 0xe8, 0xd1, 0x5c, 0xa0, 0xdb, 0x4a, 0x99,
+    0x9a, 0xd0, 0x10, 0xcd, 0x27, 0x49, 0x37, 0x90, 0x11, 0x2c, 0x77, 0xa5, 0x10, 0xe1, 0xed, 0xc7,
+    0xbb, 0xcf, 0x3e, 0xb4, 0xa4, 0x4b, 0x90, 0x04, 0x2d, 0x31, 0xaa, 0x15, 0x3c, 0x2b, 0x43, 0x94,
+    0x0f, 0xc8, 0xc7, 0x75, 0x31, 0x0e, 0x87, 0x68, 0x24, 0x1a, 0xdd, 0x3a, 0xe2, 0x76, 0x1a, 0x49,
+    0x72, 0xf0, 0x80, 0x85, 0xf3, 0x49, 0x06, 0xfb, 0x44, 0x5d, 0xf4, 0x1d, 0x84, 0xd3, 0x08, 0x75,
+    0xab, 0x4c, 0x17, 0xf2, 0x36, 0x2d, 0x9f, 0x08, 0xdb, 0x5b, 0x87, 0xd0, 0xfb, 0x55, 0x0c, 0xbf,
+    0x8f, 0x85, 0x24, 0xb4, 0xce, 0x61, 0xfd, 0xa2, 0x9b, 0x6d, 0x97, 0xb5, 0xc0, 0x1a, 0xdd, 0x61,
+    0x72, 0x7d, 0x01, 0x9c, 0x68, 0xd6, 0xb6, 0x18, 0x47, 0x43, 0x4f, 0x9f, 0x2f, 0x84, 0xff, 0xc5,
+    0x2a, 0x1f, 0xd5, 0xda, 0x51, 0xd7, 0xda, 0x9c, 0x81, 0x94, 0x18, 0x23, 0x2c, 0xae, 0x49, 0x2c,
+    0xf5, 0x9e, 0xc6, 0xb0, 0x9d, 0x1d, 0xb9, 0x1c, 0xd2, 0xf7, 0xbb, 0xa2, 0x1c, 0xaf, 0x1c, 0x8d,
+    0x46, 0x89, 0x8a, 0xee, 0xa6, 0x83, 0x0b, 0x7d, 0x38, 0x45, 0x5b, 0x57, 0x7d, 0xb7, 0x2c, 0x08,
+    0x17, 0x96, 0x2e, 0x25, 0xf0, 0xff, 0xa8, 0x8f, 0x8b, 0x4e, 0x1f, 0xef, 0x95, 0x5a, 0x4b, 0x20,
+    0x0b, 0xec, 0x9a, 0x86, 0x53, 0x33, 0x90, 0x8a, 0x3e, 0x00, 0xb8, 0xa5, 0xc2, 0x57, 0x30, 0x2b,
+    0x6f, 0x25, 0x50, 0x0b, 0xa4, 0x07, 0x14, 0xea, 0x1b, 0xe0, 0x92, 0x95, 0x30, 0xd6, 0x15, 0x63,
+    0x7d, 0x92, 0x1d, 0xa2, 0x6a, 0x10, 0x60, 0x46, 0x42, 0x9b, 0xcd, 0x33, 0x4c, 0x42, 0x4b, 0xba,
+    0xbb, 0x26, 0x8d, 0x6a, 0xe0, 0xc6, 0x83, 0xd5, 0xe5, 0x42, 0x0a, 0x76, 0x4f, 0x50, 0x03, 0x6a,
+    0x4b, 0x9c, 0x22, 0xc9, 0x85, 0xec, 0x54, 0x6b, 0x8e, 0x41, 0x5e, 0xc7, 0x3b, 0x68, 0xd7, 0xa9,
+    0xe1, 0x92, 0xac, 0x4c, 0x22, 0x28, 0x17, 0xc9, 0xf5, 0xc8, 0xab, 0xe7, 0xbe, 0x18, 0xd3, 0x3d,
+    0x0d, 0xff, 0x98, 0xfe, 0xc4, 0xd7, 0x37, 0xf9, 0xff, 0xa0, 0x1c, 0x49, 0x48, 0x80, 0x3f, 0x2f,
+    0x81, 0x50, 0xbd, 0x45, 0xe7, 0x39, 0x94, 0x40, 0x1f, 0xf0, 0xe9, 0xda, 0x21, 0x57, 0x5f, 0x7c,
+    0x95, 0x0e, 0xc6, 0x8f, 0xb0, 0xe4, 0x13, 0x4e, 0xa7, 0xdd, 0x8b, 0x8e, 0xc9, 0x32, 0xf0, 0xea,
+    0xf7, 0x7b, 0xe2, 0x68, 0xc3, 0x63, 0x75, 0x87, 0x7e, 0x58, 0xf8, 0x95, 0x58, 0xb7, 0x06, 0xf8,
+    0x28, 0x96, 0x59, 0xa3, 0x8c, 0x6a, 0x2a, 0x65, 0xf9, 0xdb, 0x2a, 0xda, 0x2f, 0x45, 0x43, 0x60,
+    0x83, 0x2a, 0xb3, 0x84, 0x1a, 0x40, 0x1c, 0x8e, 0xa0, 0x46, 0xc3, 0x51, 0x4d, 0xf1, 0x8c, 0xa5,
+    0x82, 0xbf, 0xf6, 0x7b, 0xb8, 0xc2, 0x9d, 0x8a, 0x36, 0x6b, 0x20, 0xae, 0x82, 0xfe, 0x10, 0x35,
+    0x3d, 0x5c, 0xdb, 0xd4, 0xa2, 0xa4, 0x13, 0x7d, 0x90, 0x82, 0x6f, 0x9e, 0x70, 0x79, 0xc4, 0x92,
+    0xda, 0x3c, 0x55, 0x48, 0xd2, 0xb6, 0x61, 0x55, 0x1e, 0x37, 0x33, 0x04, 0xc1, 0xbc, 0x86, 0xe6,
+    0x99, 0x01, 0xe4, 0xc3, 0xb8, 0xb7, 0xe1, 0x81, 0x78, 0xf5, 0x03, 0xf6, 0x62, 0x30, 0x3c, 0x48,
+    0xf4, 0x70, 0x0e, 0x0c, 0xb9, 0xe8, 0xf0, 0x7c, 0xa3, 0x23, 0xff, 0xa7, 0x36, 0xbc, 0xec, 0xda,
+    0xf0, 0xb0, 0xff, 0xd2, 0xa4, 0x7a, 0x62, 0x5a, 0xe7, 0x1d, 0xc2, 0x67, 0xc7, 0x76, 0x67, 0xf4,
+    0xd5, 0x4f, 0xe3, 0xa4, 0x9c, 0x9a, 0x9a, 0xb5, 0x68, 0xf2, 0xa5, 0xc2, 0xcc, 0xeb, 0x6b, 0x32,
+    0x39, 0xd7, 0x0f, 0x37, 0xa4, 0x97, 0xd3, 0x52, 0x2a, 0x76, 0x8f, 0x7a, 0xba, 0x03, 0xe9, 0x9b,
+    0xe7, 0xa0, 0xd7, 0xba, 0xc9, 0xfc, 0x48, 0x89, 0xbc, 0x69, 0x48, 0x16, 0x79, 0xf7, 0xf9, 0x9c,
+    0x15, 0x71, 0x6f, 0x60, 0xf7, 0x75, 0xff, 0x22, 0x3c, 0x06, 0xeb, 0x48, 0xd0, 0x9e, 0xc6, 0x20,
+    0x97, 0x79, 0xd6, 0x6a, 0x4e, 0x1d, 0x74, 0x48, 0x5e, 0x05, 0xcd, 0x21, 0x9b, 0x58, 0xb3, 0x70,
+    0xc9, 0x63, 0x90, 0x64, 0x9c, 0xba, 0xfd, 0xf8, 0xed, 0xf5, 0x65, 0xc3, 0x20, 0x1e, 0xb4, 0x9f,
+    0xee, 0x28, 0xa9, 0x40, 0xea, 0x3c, 0x3c, 0x61, 0xe5, 0xa2, 0x52, 0x0a, 0xa7, 0xdb, 0xb6, 0x12,
+    0xa8, 0x97, 0x5e, 0x9b, 0x29, 0x43, 0xbb, 0xd7, 0x3f, 0x53, 0x52, 0x26, 0x29, 0x58, 0x56, 0x01,
+    0x6f, 0x25, 0x44, 0x85, 0x76, 0xcf, 0x4a, 0x87, 0xac, 0xd5, 0xd8, 0x70, 0x08, 0x24, 0x47, 0x2f,
+    0x7b, 0x4c, 0x85, 0x53, 0x1a, 0x79, 0x98, 0x0d, 0x78, 0xd8, 0xb7, 0xb5, 0xe9, 0xac, 0x97, 0xf8,
+    0xc8, 0x81, 0x49, 0x47, 0x24, 0xae, 0x92, 0xaf, 0x7e, 0x20, 0x56, 0x49, 0xc1, 0xc9, 0xcb, 0xe9,
+    0x74, 0x7a, 0x43, 0x62, 0xdc, 0x18, 0x93, 0x9c, 0xc7, 0x30, 0x97, 0x5d, 0x18, 0xc4, 0xac, 0x30,
+    0xca, 0xcb, 0x55, 0xf8, 0xdb, 0x1b, 0x9f, 0xe3, 0xbf, 0x17, 0x43, 0x70, 0xf8, 0x23, 0xe1, 0xc5,
+    0xd9, 0xd5, 0x65, 0xe8, 0xb5, 0x78, 0x89, 0x91, 0x5a, 0x79, 0x9a, 0x51, 0x2e, 0x85, 0x0d, 0x32,
+    0x97, 0x62, 0xf0, 0xe2, 0xe1, 0x12, 0x6b, 0xd1, 0xca, 0x7f, 0x39, 0x68, 0x8f, 0x2c, 0xfa, 0x19,
+    0x38, 0x94, 0x5f, 0x9c, 0xc1, 0x27, 0x54, 0x07, 0xad, 0x3d, 0xfb, 0xee, 0x3e, 0xd6, 0xd2, 0xb1,
+    0x57, 0x4f, 0x6b, 0x35, 0xf5, 0x85, 0xcd, 0xca, 0x38, 0x4c, 0xfc, 0x44, 0x77, 0x46, 0xc9, 0xd4,
+    0x9d, 0x3e, 0xd6, 0xb1, 0x8a, 0x57, 0x12, 0x90, 0xce, 0x35, 0xd5, 0xa9, 0xc3, 0x0e, 0xbe, 0x4e,
+    0x9e, 0x1c, 0x50, 0x3d, 0xd1, 0x94, 0xdd, 0xaf, 0x8d, 0x6a, 0x1b, 0x9e, 0x9f, 0x00, 0xf8, 0x14,
+    0x7d, 0x48, 0x74, 0x3a, 0x18, 0x60, 0xc7, 0xc1, 0x57, 0x38, 0x2e, 0x94, 0xd9, 0xa1, 0x3d, 0xb8,
+    0xef, 0x8c, 0xfd, 0x2e, 0xba, 0x90, 0xe0, 0x73, 0x3a, 0x1b, 0xd3, 0x8f, 0x65, 0x46, 0x68, 0x47,
+    0xac, 0x61, 0xfd, 0xd7, 0xf1, 0x5f, 0xfe, 0xe3, 0x98, 0x5e, 0x00, 0xf0, 0x1f, 0xf9, 0x6c, 0xca,
+    0x2e, 0x27, 0x33, 0x3e, 0x7b, 0x13, 0x3a, 0x34, 0xd8, 0x7a, 0xdf, 0xf4, 0x79, 0x3c, 0x8e, 0x1f,
+    0xf8, 0x7f, 0x03, 0xf5, 0x78, 0xa7, 0x52, 0xf8, 0x0b, 0x00, 0x00,
+};
+
+// wifi_saved.html: 1335 bytes minified, 720 gzipped
+static const uint8_t WEB_WIFI_SAVED_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x54, 0x5d, 0x6f, 0xda, 0x40,
+    0x10, 0x7c, 0xf7, 0xaf, 0xd8, 0x3a, 0x0f, 0x10, 0x15, 0xfc, 0x41, 0x21, 0x6a, 0x8d, 0x41, 0x8d,
+    0xd2, 0x46, 0x8d, 0xd4, 0xaa, 0x51, 0x83, 0x14, 0xf5, 0xf1, 0xf0, 0xad, 0xf1, 0x29, 0xf6, 0x9d,
+    0x75, 0x77, 0x86, 0xd0, 0x2a, 0xff, 0xbd, 0x7b, 0xb6, 0x21, 0x69, 0x9a, 0x48, 0x15, 0x0f, 0x27,
+    0x76, 0xf7, 0x66, 0xe6, 0x66, 0x07, 0xd2, 0x37, 0x9f, 0xbe, 0x5f, 0xac, 0x7e, 0x5e, 0x7f, 0x86,
+    0xc2, 0x56, 0xe5, 0xd2, 0x4b, 0x0f, 0x07, 0x32, 0x4e, 0x47, 0x85, 0x96, 0x81, 0x64, 0x15, 0x2e,
+    0xfc, 0xad, 0xc0, 0x5d, 0xad, 0xb4, 0xf5, 0x21, 0x53, 0xd2, 0xa2, 0xb4, 0x0b, 0x7f, 0x27, 0xb8,
+    0x2d, 0x16, 0x1c, 0xb7, 0x22, 0xc3, 0x71, 0xfb, 0x65, 0x04, 0x42, 0x0a, 0x2b, 0x58, 0x39, 0x36,
+    0x19, 0x2b, 0x71, 0x11, 0x07, 0x91, 0x4f, 0x30, 0x56, 0xd8, 0x12, 0x97, 0xb7, 0xe2, 0x52, 0xc0,
+    0x0d, 0x5a, 0x2b, 0xe4, 0xc6, 0xc0, 0x0d, 0xdb, 0x22, 0x4f, 0xc3, 0xae, 0xe5, 0xa5, 0xc6, 0xee,
+    0xdd, 0xb9, 0x56, 0x7c, 0x0f, 0xbf, 0xbd, 0x9c, 0x28, 0xc6, 0x39, 0xab, 0x44, 0xb9, 0x4f, 0xe0,
+    0x5c, 0x13, 0xe0, 0x08, 0x0c, 0x93, 0x66, 0x6c, 0x50, 0x8b, 0x7c, 0xee, 0x55, 0xec, 0xbe, 0x23,
+    0x4c, 0xe0, 0x2c, 0x8a, 0xea, 0x7b, 0x57, 0xd1, 0x1b, 0x21, 0x13, 0x88, 0x80, 0x35, 0x56, 0xcd,
+    0xbd, 0x9a, 0x71, 0x4e, 0x3c, 0x09, 0x4c, 0xda, 0xb6, 0xc5, 0x7b, 0x3b, 0x66, 0xa5, 0xd8, 0xd0,
+    0x48, 0x46, 0xe2, 0x51, 0xcf, 0xbd, 0x07, 0xef, 0x63, 0x85, 0x5c, 0x30, 0x18, 0x3e, 0x85, 0x9b,
+    0xd2, 0xfc, 0x29, 0x49, 0xe8, 0x94, 0xc0, 0x11, 0x27, 0x9e, 0x11, 0x0e, 0x3c, 0x78, 0x45, 0x4c,
+    0xd5, 0x56, 0x9f, 0x11, 0xbf, 0x90, 0xf0, 0xa7, 0x5d, 0xfd, 0xc1, 0x0b, 0x2a, 0x34, 0x86, 0x6d,
+    0x90, 0x2e, 0x1f, 0xd4, 0x38, 0x72, 0x88, 0xfe, 0x51, 0xb3, 0x56, 0x9a, 0xa3, 0x26, 0x4c, 0xea,
+    0x1a, 0x55, 0x0a, 0x0e, 0x27, 0xd3, 0x8b, 0xf3, 0xcb, 0x59, 0x74, 0x68, 0x8d, 0x35, 0xe3, 0xa2,
+    0x31, 0x09, 0x38, 0x52, 0x07, 0xdd, 0xe8, 0xd2, 0x10, 0xef, 0x33, 0x5c, 0xe8, 0x3a, 0xcf, 0x0d,
+    0xab, 0x94, 0x54, 0xa6, 0x66, 0x19, 0x12, 0x1c, 0xcb, 0xee, 0x36, 0x5a, 0x35, 0x92, 0x27, 0x70,
+    0x92, 0xcf, 0xdc, 0xe7, 0x89, 0x1a, 0x42, 0x87, 0xf8, 0x89, 0xa2, 0x23, 0xed, 0x3b, 0x57, 0xdb,
+    0x51, 0x6d, 0xbc, 0xd6, 0xc8, 0xee, 0x12, 0x68, 0x0f, 0x32, 0xb0, 0x7c, 0xc5, 0xb6, 0x69, 0xd4,
+    0xdb, 0xf6, 0x68, 0xc2, 0x7f, 0x58, 0x37, 0x39, 0x58, 0x97, 0x86, 0xfd, 0xfe, 0xd3, 0xb0, 0x4f,
+    0x9e, 0xb3, 0xdf, 0xe5, 0x30, 0x7e, 0x39, 0x36, 0x54, 0xf7, 0x52, 0x2e, 0xb6, 0x90, 0x95, 0xcc,
+    0x98, 0x85, 0xdf, 0xb3, 0xba, 0xb0, 0xd5, 0xdd, 0x0d, 0x4a, 0x69, 0x2e, 0x36, 0x8d, 0x66, 0x56,
+    0x28, 0x09, 0x05, 0x33, 0xb0, 0x46, 0x94, 0x94, 0x22, 0xba, 0x1f, 0xa4, 0x61, 0xdd, 0x4e, 0xae,
+    0x0a, 0x84, 0x2e, 0xbf, 0xb0, 0x13, 0x65, 0x09, 0x52, 0xed, 0x40, 0xa3, 0xb1, 0x4c, 0x5b, 0x60,
+    0x92, 0x43, 0x9b, 0x14, 0x30, 0x68, 0x9b, 0x9a, 0x5c, 0xe5, 0x08, 0x56, 0x11, 0x70, 0x55, 0x97,
+    0x68, 0xf1, 0x6f, 0x86, 0x23, 0xe4, 0x6d, 0x41, 0x2c, 0xc2, 0x0e, 0x0c, 0x01, 0x31, 0xbe, 0x1f,
+    0xc1, 0x5e, 0x35, 0x90, 0x31, 0xf9, 0x78, 0xaf, 0x83, 0x63, 0x36, 0xe9, 0xaf, 0x1c, 0xde, 0x40,
+    0x9b, 0xf4, 0x97, 0x29, 0x83, 0x42, 0x63, 0xbe, 0xf0, 0x0b, 0x6b, 0xeb, 0x24, 0x0c, 0xd7, 0x42,
+    0x72, 0x91, 0x31, 0xab, 0x74, 0x50, 0x2a, 0xfa, 0x4d, 0xf9, 0xcb, 0x57, 0x1a, 0x69, 0xc8, 0x96,
+    0x07, 0x0d, 0xa9, 0xa9, 0x68, 0x55, 0xcb, 0xe1, 0x55, 0x0e, 0xcf, 0xc7, 0x80, 0x2b, 0x34, 0x72,
+    0x60, 0x81, 0xb6, 0x7b, 0xd7, 0x89, 0xab, 0xd8, 0x1e, 0x24, 0x22, 0x77, 0x8f, 0xcb, 0x69, 0x1c,
+    0xec, 0xd1, 0x15, 0x7a, 0xc5, 0xd5, 0x35, 0xd0, 0x1e, 0xc9, 0x14, 0x13, 0x40, 0x67, 0x57, 0xce,
+    0x9a, 0xd2, 0x82, 0x30, 0x10, 0x7f, 0x98, 0x04, 0xf1, 0xd9, 0xfb, 0x60, 0x1a, 0xc4, 0x23, 0x58,
+    0x37, 0x54, 0xb3, 0x2d, 0xd8, 0x9a, 0xa6, 0x44, 0x9e, 0xa3, 0x26, 0xfb, 0x68, 0xbe, 0x46, 0xe9,
+    0x72, 0x00, 0xb4, 0x06, 0xa2, 0xd3, 0x40, 0x71, 0x24, 0x57, 0x83, 0x53, 0x5a, 0x7a, 0x2b, 0xb3,
+    0x53, 0x1d, 0xd2, 0x36, 0x5f, 0xdc, 0xc9, 0x61, 0x1f, 0x42, 0xc2, 0x8c, 0xbc, 0x23, 0xd7, 0xb9,
+    0x09, 0x82, 0xde, 0x6f, 0x93, 0x69, 0x51, 0xdb, 0xa5, 0x47, 0x9e, 0xae, 0x44, 0x85, 0x84, 0x3c,
+    0xcc, 0x1b, 0x99, 0xb9, 0x8d, 0x0c, 0x5d, 0x1c, 0xb9, 0xca, 0x9a, 0x8a, 0x64, 0x04, 0x2e, 0x4f,
+    0x81, 0x90, 0x12, 0xf5, 0x97, 0xd5, 0xb7, 0xaf, 0xf0, 0x76, 0x01, 0x03, 0xe2, 0xfa, 0xd1, 0x61,
+    0x93, 0xba, 0x1e, 0x71, 0x40, 0xf9, 0x1e, 0xb9, 0x34, 0x47, 0xa7, 0x73, 0x97, 0xca, 0x1e, 0x3e,
+    0x0d, 0xfb, 0x3c, 0x86, 0xdd, 0xff, 0xe3, 0x1f, 0xf6, 0xd1, 0xc5, 0x6d, 0x37, 0x05, 0x00, 0x00,
+};
+
+// calendar_saved.html: 469 bytes minified, 311 gzipped
+static const uint8_t WEB_CALENDAR_SAVED_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x51, 0x41, 0x4e, 0xc3, 0x30,
+    0x10, 0xbc, 0xe7, 0x15, 0x4b, 0xb8, 0x92, 0x26, 0x45, 0x94, 0x43, 0xea, 0x46, 0xaa, 0x5a, 0x90,
+    0x38, 0x81, 0x28, 0x17, 0x8e, 0xdb, 0x78, 0x93, 0x58, 0x72, 0x9c, 0xc8, 0xde, 0x94, 0x46, 0xa8,
+    0x7f, 0xc7, 0x6e, 0x53, 0x71, 0x40, 0x9c, 0x46, 0xda, 0x99, 0xf1, 0xec, 0x8e, 0xc5, 0xcd, 0xf6,
+    0x75, 0xf3, 0xf1, 0xf9, 0xf6, 0x04, 0x0d, 0xb7, 0xba, 0x88, 0xc4, 0x15, 0x08, 0xa5, 0x07, 0x56,
+    0xac, 0xa9, 0xd8, 0xa0, 0x26, 0x23, 0xd1, 0xc2, 0x8e, 0x98, 0x95, 0xa9, 0x1d, 0xec, 0xf0, 0x40,
+    0x52, 0xa4, 0x17, 0x3a, 0x12, 0x8e, 0xc7, 0x80, 0xfb, 0x4e, 0x8e, 0xf0, 0x0d, 0x55, 0x67, 0x38,
+    0xa9, 0xb0, 0x55, 0x7a, 0xcc, 0x61, 0x6d, 0x15, 0xea, 0x3b, 0x70, 0x68, 0x5c, 0xe2, 0xc8, 0xaa,
+    0x6a, 0x09, 0x2d, 0x1e, 0x93, 0x2f, 0x25, 0xb9, 0xc9, 0xe1, 0x31, 0xcb, 0xfa, 0x63, 0x98, 0xd8,
+    0x5a, 0x99, 0x1c, 0x32, 0xc0, 0x81, 0xbb, 0x25, 0xf4, 0x28, 0xa5, 0xcf, 0xc9, 0xe1, 0xfe, 0x4c,
+    0x33, 0x1d, 0x39, 0x41, 0xad, 0x6a, 0x2f, 0x29, 0xc9, 0x30, 0xd9, 0x25, 0x9c, 0xa2, 0x59, 0x4b,
+    0xce, 0x61, 0x4d, 0x3e, 0xf1, 0xea, 0x0f, 0x72, 0xc8, 0xfe, 0xf8, 0xf7, 0x9d, 0x95, 0x64, 0x73,
+    0x98, 0x7b, 0xd6, 0x75, 0x5a, 0x49, 0xb8, 0x7d, 0xd8, 0xac, 0x9f, 0x17, 0xd9, 0x95, 0x4a, 0x2c,
+    0x4a, 0x35, 0xb8, 0x1c, 0x16, 0x41, 0x7e, 0x8a, 0x44, 0x3a, 0x5d, 0x24, 0xd2, 0xa9, 0x88, 0x70,
+    0x5a, 0xa8, 0x65, 0xfe, 0x7f, 0x19, 0x9e, 0x8b, 0x84, 0x54, 0x07, 0x28, 0x35, 0x3a, 0xb7, 0x8a,
+    0xa7, 0xf5, 0x62, 0x3f, 0xed, 0x7f, 0x5d, 0x2f, 0x5b, 0x68, 0xd0, 0xc1, 0x9e, 0xc8, 0xc0, 0xd0,
+    0x4b, 0x64, 0x92, 0xe0, 0x86, 0xb2, 0xf4, 0xe2, 0x6a, 0xd0, 0x7a, 0x9c, 0x89, 0xb4, 0x0f, 0xb9,
+    0xfe, 0xa1, 0xb3, 0x51, 0x20, 0x34, 0x96, 0xaa, 0x55, 0x9c, 0xc6, 0xc5, 0x3b, 0xf1, 0x60, 0x0d,
+    0x70, 0x17, 0xb2, 0x87, 0x5e, 0xa4, 0x58, 0x4c, 0xea, 0x69, 0xbd, 0xf4, 0xf2, 0x7b, 0x3f, 0x7c,
+    0xbb, 0x49, 0x1a, 0xd5, 0x01, 0x00, 0x00,
+};
+
+static const WebAsset WEB_SETUP_CSS = {"/setup.css", "text/css", "\"f7c712cd87ca3549\"", "public, max-age=31536000, immutable", WEB_SETUP_CSS_GZ, sizeof(WEB_SETUP_CSS_GZ)};
+static const WebAsset WEB_SETUP_JS = {"/setup.js", "application/javascript", "\"a2eed6d54c315d58\"", "public, max-age=31536000, immutable", WEB_SETUP_JS_GZ, sizeof(WEB_SETUP_JS_GZ)};
+static const WebAsset WEB_INDEX_HTML = {"/", "text/html", "\"b6b311cf66450dbb\"", "no-cache", WEB_INDEX_HTML_GZ, sizeof(WEB_INDEX_HTML_GZ)};
+static const WebAsset WEB_WIFI_SAVED_HTML = {nullptr, "text/html", "\"6240ac8ce16af102\"", "no-cache", WEB_WIFI_SAVED_HTML_GZ, sizeof(WEB_WIFI_SAVED_HTML_GZ)};
+static const WebAsset WEB_CALENDAR_SAVED_HTML = {nullptr, "text/html", "\"25fc2f29aa0c9464\"", "no-cache", WEB_CALENDAR_SAVED_HTML_GZ, sizeof(WEB_CALENDAR_SAVED_HTML_GZ)};
+
+static const WebAsset* const WEB_ROUTES[] = {&WEB_SETUP_CSS, &WEB_SETUP_JS, &WEB_INDEX_HTML};
+
+#endif